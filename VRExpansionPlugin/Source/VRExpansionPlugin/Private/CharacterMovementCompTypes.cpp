@@ -13,6 +13,7 @@
 #include "VRBaseCharacter.h"
 #include "VRRootComponent.h"
 #include "VRPlayerController.h"
+#include "VRMoveDeltaEncoding.h"
 	
 FSavedMove_VRBaseCharacter::FSavedMove_VRBaseCharacter() : FSavedMove_Character()
 {
@@ -20,6 +21,8 @@ FSavedMove_VRBaseCharacter::FSavedMove_VRBaseCharacter() : FSavedMove_Character(
 	LFDiff = FVector::ZeroVector;
 	VRCapsuleRotation = FRotator::ZeroRotator;
 	VRReplicatedMovementMode = EVRConjoinedMovementModes::C_MOVE_MAX;// _None;
+	SentLocation = FVector::ZeroVector;
+	bHasSentLocation = false;
 }
 
 uint8 FSavedMove_VRBaseCharacter::GetCompressedFlags() const
@@ -55,18 +58,42 @@ bool FSavedMove_VRBaseCharacter::CanCombineWith(const FSavedMovePtr& NewMove, AC
 	if (!ConditionalValues.MoveActionArray.CanCombine() || !nMove->ConditionalValues.MoveActionArray.CanCombine())
 		return false;
 
-	if (!ConditionalValues.CustomVRInputVector.IsZero() || !nMove->ConditionalValues.CustomVRInputVector.IsZero())
-		return false;
+	const UVRBaseCharacterMovementComponent* MoveComp = Character ? Cast<UVRBaseCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
 
-	if (!ConditionalValues.RequestedVelocity.IsZero() || !nMove->ConditionalValues.RequestedVelocity.IsZero())
-		return false;
+	if (MoveComp && MoveComp->bUseRelaxedMoveCombining)
+	{
+		// Offsets are summed in CombineWith, only combine while the sums stay inside what both sides clamp a move of the combined length to
+		// Only the moves own values are used, this is also called when merging replayed moves
+		const float MaxOffsetSq = FMath::Square(MoveComp->GetMaxVROffsetForMove(DeltaTime + nMove->DeltaTime));
 
-	// Hate this but we really can't combine if I am sending a new capsule height
-	if (!FMath::IsNearlyEqual(CapsuleHeight, nMove->CapsuleHeight))
-		return false;
+		if ((ConditionalValues.CustomVRInputVector + nMove->ConditionalValues.CustomVRInputVector).SizeSquared() > MaxOffsetSq)
+			return false;
 
-	if (!LFDiff.IsZero() && !nMove->LFDiff.IsZero() && !FVector::Coincident(LFDiff.GetSafeNormal(), nMove->LFDiff.GetSafeNormal(), AccelDotThresholdCombine))
-		return false;
+		if ((LFDiff + nMove->LFDiff).SizeSquared2D() > MaxOffsetSq)
+			return false;
+
+		if (!ConditionalValues.RequestedVelocity.Equals(nMove->ConditionalValues.RequestedVelocity))
+			return false;
+
+		// The combined move sends the newest height
+		if (FMath::Abs(CapsuleHeight - nMove->CapsuleHeight) > MoveComp->RelaxedCombineCapsuleHeightTolerance)
+			return false;
+	}
+	else
+	{
+		if (!ConditionalValues.CustomVRInputVector.IsZero() || !nMove->ConditionalValues.CustomVRInputVector.IsZero())
+			return false;
+
+		if (!ConditionalValues.RequestedVelocity.IsZero() || !nMove->ConditionalValues.RequestedVelocity.IsZero())
+			return false;
+
+		// Hate this but we really can't combine if I am sending a new capsule height
+		if (!FMath::IsNearlyEqual(CapsuleHeight, nMove->CapsuleHeight))
+			return false;
+
+		if (!LFDiff.IsZero() && !nMove->LFDiff.IsZero() && !FVector::Coincident(LFDiff.GetSafeNormal(), nMove->LFDiff.GetSafeNormal(), AccelDotThresholdCombine))
+			return false;
+	}
 
 	return FSavedMove_Character::CanCombineWith(NewMove, Character, MaxDelta);
 }
@@ -114,6 +141,9 @@ void FSavedMove_VRBaseCharacter::SetInitialPosition(ACharacter* C)
 		else
 			ConditionalValues.RequestedVelocity = FVector::ZeroVector;
 
+		// Captured here as well as in PostUpdate so that CanCombineWith can check the new moves own input
+		ConditionalValues.CustomVRInputVector = moveComp->CustomVRInputVector;
+
 		// Throw out the Z value of the headset, its not used anyway for movement
 		// Instead, re-purpose it to be the capsule half height
 		if (AVRBaseCharacter* BaseChar = Cast<AVRBaseCharacter>(C))
@@ -175,6 +205,13 @@ void FSavedMove_VRBaseCharacter::CombineWith(const FSavedMove_Character* OldMove
 
 	// Merge if we had valid mergable move actions
 	ConditionalValues.MoveActionArray.MoveActions.Append(BaseSavedMovePending->ConditionalValues.MoveActionArray.MoveActions);
+
+	// The pending moves custom input was reverted along with its position, replay it as part of the combined move
+	// Only ever non zero with relaxed combining
+	if (UVRBaseCharacterMovementComponent* BaseCharMove = Cast<UVRBaseCharacterMovementComponent>(CharMovement))
+	{
+		BaseCharMove->CustomVRInputVector += BaseSavedMovePending->ConditionalValues.CustomVRInputVector;
+	}
 }
 
 void FSavedMove_VRBaseCharacter::PostUpdate(ACharacter* C, EPostUpdateMode PostUpdateMode)
@@ -239,6 +276,9 @@ void FSavedMove_VRBaseCharacter::Clear()
 	ConditionalValues.MoveActionArray.Clear();
 	//ConditionalValues.MoveAction.Clear();
 
+	SentLocation = FVector::ZeroVector;
+	bHasSentLocation = false;
+
 	FSavedMove_Character::Clear();
 }
 
@@ -327,6 +367,13 @@ void FVRCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Cha
 		LFDiff = SavedMove->LFDiff;
 		CapsuleHeight = SavedMove->CapsuleHeight;
 		VRCapsuleRotation = FRotator::CompressAxisToShort(SavedMove->VRCapsuleRotation.Yaw);
+
+		// Replays refill the move data, only the first fill is what the server actually received
+		if (MoveType == ENetworkMoveType::NewMove && !SavedMove->bHasSentLocation)
+		{
+			SavedMove->SentLocation = Location;
+			SavedMove->bHasSentLocation = true;
+		}
 	}
 }
 
@@ -337,22 +384,50 @@ bool FVRCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Charact
 	bool bLocalSuccess = true;
 	const bool bIsSaving = Ar.IsSaving();
 
-	Ar << TimeStamp;
+	// The pending and old moves are serialized after the new move in the same container
+	// So they can be sent as residuals against it, which was already decoded by the time we get here on the server
+	const FVRCharacterNetworkMoveData* DeltaReference = nullptr;
+	if (MoveType != ENetworkMoveType::NewMove)
+	{
+		bool bDeltaEncoded = false;
+		if (bIsSaving)
+		{
+			const UVRBaseCharacterMovementComponent* BaseMoveComp = Cast<UVRBaseCharacterMovementComponent>(&CharacterMovement);
+			bDeltaEncoded = BaseMoveComp && BaseMoveComp->bDeltaEncodeMoveData;
+		}
+
+		Ar.SerializeBits(&bDeltaEncoded, 1);
 
-	// Handle switching the acceleration rep
-	// Can't use SerializeOptionalValue here as I don't want to bitwise compare floats
-	bool bRepAccel = bIsSaving ? !Acceleration.IsNearlyZero() : false;
-	Ar.SerializeBits(&bRepAccel, 1);
+		if (bDeltaEncoded)
+		{
+			DeltaReference = static_cast<const FVRCharacterNetworkMoveData*>(CharacterMovement.GetNetworkMoveDataContainer().GetNewMoveData());
+		}
+	}
 
-	if (bRepAccel)
+	if (DeltaReference)
 	{
-		Acceleration.NetSerialize(Ar, PackageMap, bLocalSuccess);
+		VRMoveDeltaEncoding::SerializeTimeStamp(Ar, TimeStamp, DeltaReference->TimeStamp);
+		bLocalSuccess &= VRMoveDeltaEncoding::SerializeVectorResidual<10, 24>(Ar, Acceleration, DeltaReference->Acceleration);
 	}
 	else
 	{
-		if (!bIsSaving)
+		Ar << TimeStamp;
+
+		// Handle switching the acceleration rep
+		// Can't use SerializeOptionalValue here as I don't want to bitwise compare floats
+		bool bRepAccel = bIsSaving ? !Acceleration.IsNearlyZero() : false;
+		Ar.SerializeBits(&bRepAccel, 1);
+
+		if (bRepAccel)
+		{
+			Acceleration.NetSerialize(Ar, PackageMap, bLocalSuccess);
+		}
+		else
 		{
-			Acceleration = FVector::ZeroVector;
+			if (!bIsSaving)
+			{
+				Acceleration = FVector::ZeroVector;
+			}
 		}
 	}
 
@@ -365,51 +440,66 @@ bool FVRCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Charact
 
 	ACharacter* CharacterOwner = CharacterMovement.GetCharacterOwner();
 
-	bool bRepRollAndPitch = false;
+	bool bCanRepRollAndPitch = false;
 
 	if (AVRBaseCharacter* BaseChar = Cast<AVRBaseCharacter>(CharacterOwner))
 	{
-		if (BaseChar->VRMovementReference && !BaseChar->VRMovementReference->bUseClientControlRotation)
-		{
-			bRepRollAndPitch = (Roll != 0 || Pitch != 0);
-		}
+		bCanRepRollAndPitch = BaseChar->VRMovementReference && !BaseChar->VRMovementReference->bUseClientControlRotation;
 	}
 	else
 	{
-		bool bCanRepRollAndPitch = (CharacterOwner && (CharacterOwner->bUseControllerRotationRoll || CharacterOwner->bUseControllerRotationPitch));
-		bRepRollAndPitch = bCanRepRollAndPitch && (Roll != 0 || Pitch != 0);
+		bCanRepRollAndPitch = (CharacterOwner && (CharacterOwner->bUseControllerRotationRoll || CharacterOwner->bUseControllerRotationPitch));
 	}
 
-	Ar.SerializeBits(&bRepRollAndPitch, 1);
+	bool bRepRollAndPitch = bCanRepRollAndPitch && (Roll != 0 || Pitch != 0);
 
-	if (bRepRollAndPitch)
+	if (DeltaReference)
 	{
-		// Reversed the order of these
-		uint32 Rotation32 = 0;
-		uint32 Yaw32 = bIsSaving ? Yaw : 0;
+		// The reference axis as the server decoded them, roll and pitch are only ever sent when they can be
+		VRMoveDeltaEncoding::SerializeAxisResidual(Ar, Yaw, FRotator::CompressAxisToShort(DeltaReference->ControlRotation.Yaw));
+		bRepYaw = true;
 
-		if (bIsSaving)
+		if (bCanRepRollAndPitch)
 		{
-			Rotation32 = (((uint32)Roll) << 16) | ((uint32)Pitch);
-			Ar.SerializeIntPacked(Rotation32);
+			VRMoveDeltaEncoding::SerializeAxisResidual(Ar, Pitch, FRotator::CompressAxisToShort(DeltaReference->ControlRotation.Pitch));
+			VRMoveDeltaEncoding::SerializeAxisResidual(Ar, Roll, FRotator::CompressAxisToShort(DeltaReference->ControlRotation.Roll));
 		}
-		else
+
+		bRepRollAndPitch = bCanRepRollAndPitch;
+	}
+	else
+	{
+		Ar.SerializeBits(&bRepRollAndPitch, 1);
+
+		if (bRepRollAndPitch)
 		{
-			Ar.SerializeIntPacked(Rotation32);
+			// Reversed the order of these
+			uint32 Rotation32 = 0;
+			uint32 Yaw32 = bIsSaving ? Yaw : 0;
 
-			// Reversed the order of these so it costs less to replicate
-			Pitch = (Rotation32 & 65535);
-			Roll = (Rotation32 >> 16);
+			if (bIsSaving)
+			{
+				Rotation32 = (((uint32)Roll) << 16) | ((uint32)Pitch);
+				Ar.SerializeIntPacked(Rotation32);
+			}
+			else
+			{
+				Ar.SerializeIntPacked(Rotation32);
+
+				// Reversed the order of these so it costs less to replicate
+				Pitch = (Rotation32 & 65535);
+				Roll = (Rotation32 >> 16);
+			}
 		}
-	}
 
-	uint32 Yaw32 = bIsSaving ? Yaw : 0;
+		uint32 Yaw32 = bIsSaving ? Yaw : 0;
 
-	Ar.SerializeBits(&bRepYaw, 1);
-	if (bRepYaw)
-	{
-		Ar.SerializeIntPacked(Yaw32);
-		Yaw = (uint16)Yaw32;
+		Ar.SerializeBits(&bRepYaw, 1);
+		if (bRepYaw)
+		{
+			Ar.SerializeIntPacked(Yaw32);
+			Yaw = (uint16)Yaw32;
+		}
 	}
 
 	if (!bIsSaving)
@@ -424,14 +514,24 @@ bool FVRCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Charact
 
 	SerializeOptionalValue<uint8>(bIsSaving, Ar, CompressedMoveFlags, 0);
 	SerializeOptionalValue<uint8>(bIsSaving, Ar, MovementMode, MOVE_Walking);
-	VRCapsuleLocation.NetSerialize(Ar, PackageMap, bLocalSuccess);
-	Ar << VRCapsuleRotation;
 
-	// Location is only used for error checking, so only save for the final move.
-	//if (MoveType == ENetworkMoveType::NewMove)
-	//{
-		Location.NetSerialize(Ar, PackageMap, bLocalSuccess);
-	//}
+	if (DeltaReference)
+	{
+		bLocalSuccess &= VRMoveDeltaEncoding::SerializeVectorResidual<100, 30>(Ar, VRCapsuleLocation, DeltaReference->VRCapsuleLocation);
+		VRMoveDeltaEncoding::SerializeAxisResidual(Ar, VRCapsuleRotation, DeltaReference->VRCapsuleRotation);
+		bLocalSuccess &= VRMoveDeltaEncoding::SerializeVectorResidual<100, 30>(Ar, Location, DeltaReference->Location);
+	}
+	else
+	{
+		VRCapsuleLocation.NetSerialize(Ar, PackageMap, bLocalSuccess);
+		Ar << VRCapsuleRotation;
+
+		// Location is only used for error checking, so only save for the final move.
+		//if (MoveType == ENetworkMoveType::NewMove)
+		//{
+			Location.NetSerialize(Ar, PackageMap, bLocalSuccess);
+		//}
+	}
 
 	// Movement base needs to always send now since they allow for relative based velocity
 	SerializeOptionalValue<UPrimitiveComponent*>(bIsSaving, Ar, MovementBase, nullptr);
@@ -505,6 +605,129 @@ void FVRCharacterMoveResponseDataContainer::ServerFillResponseData(const UCharac
 	}
 }
 
+bool FVRCharacterMoveResponseDataContainer::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap)
+{
+	const UVRBaseCharacterMovementComponent* BaseMovecomp = Cast<const UVRBaseCharacterMovementComponent>(&CharacterMovement);
+	const bool bIsSaving = Ar.IsSaving();
+
+	FVector LocationReference = FVector::ZeroVector;
+	uint8 bCompact = 0;
+	if (bIsSaving)
+	{
+		bCompact = BaseMovecomp && BaseMovecomp->bCompactClientCorrections && IsCorrection() && !bRootMotionMontageCorrection && !bRootMotionSourceCorrection &&
+			BaseMovecomp->GetServerCorrectionReference(ClientAdjustment.TimeStamp, LocationReference);
+	}
+
+	Ar.SerializeBits(&bCompact, 1);
+
+	if (!bCompact)
+	{
+		return FCharacterMoveResponseDataContainer::Serialize(CharacterMovement, Ar, PackageMap);
+	}
+
+	// Leads the body so that the client can look up the reference first
+	Ar << ClientAdjustment.TimeStamp;
+
+	if (bIsSaving)
+	{
+		return SerializeCompactCorrection(Ar, LocationReference);
+	}
+
+	bool bMoveFound = false;
+	const bool bHasReference = BaseMovecomp && BaseMovecomp->GetClientCorrectionReference(ClientAdjustment.TimeStamp, LocationReference, bMoveFound);
+
+	const bool bSuccess = SerializeCompactCorrection(Ar, LocationReference);
+
+	// If the corrected move is already gone (a later ack / correction arrived first) the adjustment ignores it anyway
+	// Corrections are only made for moves that were sent as new moves, so one that we still hold always has its reference
+	if (!bHasReference && bMoveFound)
+	{
+		UE_LOG(LogVRBaseCharacterMovement, Warning, TEXT("Discarding compact correction at TimeStamp %f, the saved move has no sent location"), ClientAdjustment.TimeStamp);
+		return false;
+	}
+
+	return bSuccess;
+}
+
+bool FVRCharacterMoveResponseDataContainer::SerializeCompactCorrection(FArchive& Ar, const FVector& LocationReference)
+{
+	const bool bIsSaving = Ar.IsSaving();
+
+	if (!bIsSaving)
+	{
+		bIsGoodMove = false;
+		bRootMotionMontageCorrection = false;
+		bRootMotionSourceCorrection = false;
+	}
+
+	uint8 bHasBaseBit = bHasBase;
+	uint8 bHasRotationBit = bHasRotation;
+	uint8 bBaseRelativePositionBit = ClientAdjustment.bBaseRelativePosition;
+	uint8 bBaseRelativeVelocityBit = ClientAdjustment.bBaseRelativeVelocity;
+	uint8 bDefaultGravityBit = ClientAdjustment.GravityDirection.Equals(UCharacterMovementComponent::DefaultGravityDirection);
+	Ar.SerializeBits(&bHasBaseBit, 1);
+	Ar.SerializeBits(&bHasRotationBit, 1);
+	Ar.SerializeBits(&bBaseRelativePositionBit, 1);
+	Ar.SerializeBits(&bBaseRelativeVelocityBit, 1);
+	Ar.SerializeBits(&bDefaultGravityBit, 1);
+
+	bool bLocalSuccess = true;
+
+	if (bHasBaseBit)
+	{
+		UObject* BaseObject = ClientAdjustment.NewBase;
+		Ar << BaseObject;
+		Ar << ClientAdjustment.NewBaseBoneName;
+
+		if (!bIsSaving)
+		{
+			ClientAdjustment.NewBase = Cast<UPrimitiveComponent>(BaseObject);
+		}
+	}
+	else if (!bIsSaving)
+	{
+		ClientAdjustment.NewBase = nullptr;
+		ClientAdjustment.NewBaseBoneName = NAME_None;
+	}
+
+	bLocalSuccess &= VRMoveDeltaEncoding::SerializeVectorResidual<100, 30>(Ar, ClientAdjustment.NewLoc, LocationReference);
+	bLocalSuccess &= SerializePackedVector<10, 24>(ClientAdjustment.NewVel, Ar);
+
+	if (bHasRotationBit)
+	{
+		ClientAdjustment.NewRot.SerializeCompressedShort(Ar);
+	}
+	else if (!bIsSaving)
+	{
+		ClientAdjustment.NewRot = FRotator::ZeroRotator;
+	}
+
+	if (bDefaultGravityBit)
+	{
+		if (!bIsSaving)
+		{
+			ClientAdjustment.GravityDirection = UCharacterMovementComponent::DefaultGravityDirection;
+		}
+	}
+	else
+	{
+		bLocalSuccess &= SerializeFixedVector<1, 16>(ClientAdjustment.GravityDirection, Ar);
+	}
+
+	Ar << ClientAdjustment.MovementMode;
+
+	if (!bIsSaving)
+	{
+		bHasBase = !!bHasBaseBit;
+		bHasRotation = !!bHasRotationBit;
+		ClientAdjustment.bBaseRelativePosition = !!bBaseRelativePositionBit;
+		ClientAdjustment.bBaseRelativeVelocity = !!bBaseRelativeVelocityBit;
+		ClientAdjustment.bAckGoodMove = false;
+	}
+
+	return bLocalSuccess && !Ar.IsError();
+}
+
 FScopedMeshBoneUpdateOverrideVR::FScopedMeshBoneUpdateOverrideVR(USkeletalMeshComponent* Mesh, EKinematicBonesUpdateToPhysics::Type OverrideSetting)
 	: MeshRef(Mesh)
 {
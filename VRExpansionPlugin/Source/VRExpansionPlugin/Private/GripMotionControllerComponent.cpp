@@ -25,6 +25,7 @@
 #include "VRCharacter.h"
 #include "VRRootComponent.h"
 #include "VRGlobalSettings.h"
+#include "Misc/TrackedPoseBatchSubsystem.h"
 #include "Math/DualQuat.h"
 #include "IIdentifiableXRDevice.h" // for FXRDeviceId
 #include "XRMotionControllerBase.h" // for GetHandEnumForSourceName()
@@ -711,8 +712,18 @@ void UGripMotionControllerComponent::Server_SendControllerTransform_Implementati
 #endif
 
 	// Server should no longer call this RPC itself, but if is using non tracked then it will so keeping auth check
-	if(!bHasAuthority)
-		OnRep_ReplicatedControllerTransform();
+	if (!bHasAuthority)
+	{
+		// Batched mode applies only the newest pose once per tick
+		if (UTrackedPoseBatchSubsystem* PoseBatchSubsystem = UTrackedPoseBatchSubsystem::GetActiveBatchSubsystem(this))
+		{
+			PoseBatchSubsystem->QueuePendingPose(this);
+		}
+		else
+		{
+			OnRep_ReplicatedControllerTransform();
+		}
+	}
 }
 
 bool UGripMotionControllerComponent::Server_SendControllerTransform_Validate(FBPVRComponentPosRep NewTransform)
@@ -4669,7 +4680,23 @@ void UGripMotionControllerComponent::OnRep_ReplicatedControllerTransform()
 		ApplyTrackingParameters(ReplicatedControllerTransform.Position, true, false);
 	}
 
-	if (bSmoothReplicatedMotion)
+	if (bSmoothReplicatedMotion && bUseJitterBufferSmoothing)
+	{
+		// Large jumps (teleports) clear out the buffer and snap instead of interpolating across them.
+		// Measured from the newest buffered sample, the played back pose trails it by the buffer delay.
+		FVector NewestPosition = GetRelativeLocation();
+		NetworkJitterBuffer.GetNewestPosition(NewestPosition);
+		if (!bReppedOnce || (ReplicatedControllerTransform.Position - NewestPosition).SizeSquared() >= FMath::Square(NetworkNoSmoothUpdateDistance))
+		{
+			NetworkJitterBuffer.Reset();
+			SetRelativeLocationAndRotation(ReplicatedControllerTransform.Position, ReplicatedControllerTransform.Rotation);
+			bReppedOnce = true;
+		}
+
+		NetworkJitterBuffer.AddSample(GetWorld()->GetRealTimeSeconds(), ReplicatedControllerTransform, ReplicatedControllerTransform.Position);
+		bLerpingPosition = true;
+	}
+	else if (bSmoothReplicatedMotion)
 	{
 		if (bReppedOnce)
 		{
@@ -4803,7 +4830,22 @@ void UGripMotionControllerComponent::UpdateTracking(float DeltaTime)
 			if (!RelLoc.Equals(ReplicatedControllerTransform.Position) || !RelRot.Equals(ReplicatedControllerTransform.Rotation))
 			{
 				ControllerNetUpdateCount += DeltaTime;
-				if (ControllerNetUpdateCount >= (1.0f / ControllerNetUpdateRate))
+
+				float CurrentNetUpdateRate = ControllerNetUpdateRate;
+				if (AdaptiveNetUpdateSettings.bUseAdaptiveUpdateRate)
+				{
+					CurrentNetUpdateRate = AdaptiveNetUpdateSettings.GetAdaptiveUpdateRate(
+						ControllerNetUpdateRate,
+						RelLoc,
+						RelRot,
+						ReplicatedControllerTransform.Position,
+						ReplicatedControllerTransform.Rotation,
+						ControllerNetUpdateCount,
+						FBPVRAdaptiveNetUpdateSettings::IsOwningConnectionSaturated(GetOwner())
+					);
+				}
+
+				if (CurrentNetUpdateRate > 0.0f && ControllerNetUpdateCount >= (1.0f / CurrentNetUpdateRate))
 				{
 					ControllerNetUpdateCount = 0.0f;
 
@@ -4811,6 +4853,12 @@ void UGripMotionControllerComponent::UpdateTracking(float DeltaTime)
 					ReplicatedControllerTransform.Position = RelLoc;
 					ReplicatedControllerTransform.Rotation = RelRot;
 
+					// Receivers buffer against our clock instead of their arrival times
+					if (bUseJitterBufferSmoothing)
+					{
+						ReplicatedControllerTransform.SetSenderTime(GetWorld()->GetRealTimeSeconds());
+					}
+
 #if WITH_PUSH_MODEL
 					MARK_PROPERTY_DIRTY_FROM_NAME(UGripMotionControllerComponent, ReplicatedControllerTransform, this);
 #endif
@@ -4856,7 +4904,23 @@ void UGripMotionControllerComponent::RunNetworkedSmoothing(float DeltaTime)
 {
 	if (bLerpingPosition)
 	{
-		if (!bUseExponentialSmoothing)
+		if (bUseJitterBufferSmoothing)
+		{
+			FVector BufferedPosition;
+			FQuat BufferedRotation;
+			bool bIsExtrapolating = false;
+			if (NetworkJitterBuffer.SamplePose(GetWorld()->GetRealTimeSeconds(), BufferedPosition, BufferedRotation, bIsExtrapolating))
+			{
+				SetRelativeLocationAndRotation(BufferedPosition, BufferedRotation);
+			}
+
+			// Reached the newest sample and ran out of extrapolation, hold here until the next update comes in
+			if (NetworkJitterBuffer.HasFinishedPlayback(GetWorld()->GetRealTimeSeconds()))
+			{
+				bLerpingPosition = false;
+			}
+		}
+		else if (!bUseExponentialSmoothing)
 		{
 			ControllerNetUpdateCount += DeltaTime;
 			float LerpVal = FMath::Clamp(ControllerNetUpdateCount / (1.0f / ControllerNetUpdateRate), 0.0f, 1.0f);
@@ -8553,6 +8617,7 @@ void UGripMotionControllerComponent::CheckTransactionBuffer()
 void UGripMotionControllerComponent::SetSmoothReplicatedMotion(bool bNewSmoothReplicatedMotion)
 {
 	bSmoothReplicatedMotion = bNewSmoothReplicatedMotion;
+	++NonPoseReplicationVersion;
 #if WITH_PUSH_MODEL
 	MARK_PROPERTY_DIRTY_FROM_NAME(UGripMotionControllerComponent, bSmoothReplicatedMotion, this);
 #endif
@@ -8561,6 +8626,7 @@ void UGripMotionControllerComponent::SetSmoothReplicatedMotion(bool bNewSmoothRe
 void UGripMotionControllerComponent::SetReplicateWithoutTracking(bool bNewReplicateWithoutTracking)
 {
 	bReplicateWithoutTracking = bNewReplicateWithoutTracking;
+	++NonPoseReplicationVersion;
 #if WITH_PUSH_MODEL
 	MARK_PROPERTY_DIRTY_FROM_NAME(UGripMotionControllerComponent, bReplicateWithoutTracking, this);
 #endif
@@ -8569,6 +8635,7 @@ void UGripMotionControllerComponent::SetReplicateWithoutTracking(bool bNewReplic
 void UGripMotionControllerComponent::SetControllerNetUpdateRate(float NewControllerNetUpdateRate)
 {
 	ControllerNetUpdateRate = NewControllerNetUpdateRate;
+	++NonPoseReplicationVersion;
 #if WITH_PUSH_MODEL
 	MARK_PROPERTY_DIRTY_FROM_NAME(UGripMotionControllerComponent, ControllerNetUpdateRate, this);
 #endif
@@ -8576,6 +8643,7 @@ void UGripMotionControllerComponent::SetControllerNetUpdateRate(float NewControl
 
 void UGripMotionControllerComponent::DIRTY_GRIPPED_OBJECTS()
 {
+	++NonPoseReplicationVersion;
 #if WITH_PUSH_MODEL
 	MARK_PROPERTY_DIRTY_FROM_NAME(UGripMotionControllerComponent, GrippedObjects, this);
 #endif
@@ -8583,6 +8651,7 @@ void UGripMotionControllerComponent::DIRTY_GRIPPED_OBJECTS()
 
 void UGripMotionControllerComponent::DIRTY_LOCALLY_GRIPPED_OBJECTS()
 {
+	++NonPoseReplicationVersion;
 #if WITH_PUSH_MODEL
 	MARK_PROPERTY_DIRTY_FROM_NAME(UGripMotionControllerComponent, LocallyGrippedObjects, this);
 #endif
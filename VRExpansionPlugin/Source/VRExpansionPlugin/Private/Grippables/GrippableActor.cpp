@@ -196,8 +196,9 @@ void AGrippableActor::GatherCurrentMovement()
 				}
 			}
 
-			// Technically, the values might have stayed the same, but we'll just assume they've changed.
-			bWasRepMovementModified = true;
+			// Only dirty the property if the body moved enough to serialize differently, resting bodies cost nothing to broadcast.
+			// Non default replication modes need the server frame even when still.
+			bWasRepMovementModified = FRepMovementVR::HasChangedBeyondQuantization(LastDirtiedRepMovement, RepMovement, GetPhysicsReplicationMode() != EPhysicsReplicationMode::Default);
 
 #if UE_WITH_IRIS
 			// If RepPhysics has changed value then notify the ReplicationSystem
@@ -235,14 +236,19 @@ void AGrippableActor::GatherCurrentMovement()
 				RepMovement.LinearVelocity = GetVelocity();
 				RepMovement.AngularVelocity = FVector::ZeroVector;
 
-				// Technically, the values might have stayed the same, but we'll just assume they've changed.
-				bWasRepMovementModified = true;
+				bWasRepMovementModified = FRepMovementVR::HasChangedBeyondQuantization(LastDirtiedRepMovement, RepMovement, false);
 			}
 
 			bWasRepMovementModified = (bWasRepMovementModified || RepMovement.bRepPhysics);
 			RepMovement.bRepPhysics = false;
 		}
 
+
+		if (bWasRepMovementModified)
+		{
+			LastDirtiedRepMovement = RepMovement;
+		}
+
 #if WITH_PUSH_MODEL
 		if (bWasRepMovementModified)
 		{
@@ -477,6 +483,7 @@ bool AGrippableActor::AddToClientReplicationBucket()
 		// The subsystem automatically removes entries with the same function signature so its safe to just always add here
 		GetWorld()->GetSubsystem<UBucketUpdateSubsystem>()->AddObjectToBucket(ClientAuthReplicationData.UpdateRate, this, FName(TEXT("PollReplicationEvent")));
 		ClientAuthReplicationData.bIsCurrentlyClientAuth = true;
+		ClientAuthReplicationData.ResetTrajectory();
 
 		if (UWorld * World = GetWorld())
 			ClientAuthReplicationData.TimeAtInitialThrow = World->GetTimeSeconds();
@@ -564,6 +571,7 @@ bool AGrippableActor::PollReplicationEvent()
 		return false; // Tell the bucket subsystem to remove us from consideration
 
 	bool bRemoveBlocking = false;
+	auto SendMovement = [this](const FRepMovementVR& MovementRep) { Server_GetClientAuthReplication(MovementRep); };
 
 	if ((OurWorld->GetTimeSeconds() - ClientAuthReplicationData.TimeAtInitialThrow) > 10.0f)
 	{
@@ -571,6 +579,12 @@ bool AGrippableActor::PollReplicationEvent()
 		// Authed movement that is forcing it to keep momentum.
 		//return false; // Tell the bucket subsystem to remove us from consideration
 		bRemoveBlocking = true;
+
+		// With trajectory compression the server is still simulating the last trajectory it was sent, give it the final state
+		if (ClientAuthReplicationData.bUseTrajectoryCompression && ShouldWeSkipAttachmentReplication(false))
+		{
+			ClientAuthReplicationData.SendMovementIfNeeded(this, true, SendMovement);
+		}
 	}
 
 	// Store current transform for resting check
@@ -587,15 +601,12 @@ bool AGrippableActor::PollReplicationEvent()
 				// Need to clamp to a max time since start, to handle cases with conflicting collisions
 				if (PrimComp->IsSimulatingPhysics() && ShouldWeSkipAttachmentReplication(false))
 				{
-					FRepMovementVR ClientAuthMovementRep;
-					if (ClientAuthMovementRep.GatherActorsMovement(this))
-					{
-						Server_GetClientAuthReplication(ClientAuthMovementRep);
+					const bool bIsAwake = PrimComp->RigidBodyIsAwake();
 
-						if (PrimComp->RigidBodyIsAwake())
-						{
-							return true;
-						}
+					// Always send the final state, otherwise only send if we drifted from the trajectory the server is predicting
+					if (ClientAuthReplicationData.SendMovementIfNeeded(this, !bIsAwake, SendMovement) && bIsAwake)
+					{
+						return true;
 					}
 				}
 			}
@@ -605,6 +616,14 @@ bool AGrippableActor::PollReplicationEvent()
 				//return false; // Tell the bucket subsystem to remove us from consideration
 			}
 		}
+		else if (ClientAuthReplicationData.bUseTrajectoryCompression && ClientAuthReplicationData.bHasSentTrajectory)
+		{
+			// Came to rest without sleeping, the server is still predicting along the last trajectory so send the resting state
+			if (ShouldWeSkipAttachmentReplication(false))
+			{
+				ClientAuthReplicationData.SendMovementIfNeeded(this, true, SendMovement);
+			}
+		}
 		//else
 	//	{
 			// Difference is too small, lets end sending location
@@ -659,6 +678,7 @@ void AGrippableActor::CeaseReplicationBlocking()
 		ClientAuthReplicationData.bIsCurrentlyClientAuth = false;
 
 	ClientAuthReplicationData.LastActorTransform = FTransform::Identity;
+	ClientAuthReplicationData.ResetTrajectory();
 
 	if (ClientAuthReplicationData.ResetReplicationHandle.IsValid())
 	{
@@ -717,12 +737,7 @@ void AGrippableActor::Server_GetClientAuthReplication_Implementation(const FRepM
 {
 	if (!VRGripInterfaceSettings.bIsHeld)
 	{
-		if (!newMovement.Location.ContainsNaN() && !newMovement.Rotation.ContainsNaN())
-		{
-			FRepMovement& MovementRep = GetReplicatedMovement_Mutable();
-			newMovement.CopyTo(MovementRep);
-			OnRep_ReplicatedMovement();
-		}
+		ClientAuthReplicationData.ApplyReceivedMovement(this, newMovement);
 	}
 }
 
@@ -28,10 +28,12 @@
 #include "Chaos/Particles.h"
 //#include "Components/SkeletalMeshComponent.h"
 #include "Misc/ScopeRWLock.h"
+#include "Async/ParallelFor.h"
 
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "Engine/Player.h"
+#include "Grippables/VRPhysicsReplicationSoak.h"
 //#include "PhysicsInterfaceTypesCore.h"
 
 // I cannot dynamic cast without RTTI so I am using a static var as a declarative in case the user removed our custom replicator
@@ -41,6 +43,67 @@ namespace VRPhysicsReplicationStatics
 	static bool bHasVRPhysicsReplication = false;
 }
 
+namespace VRPhysicsReplicationCVars
+{
+	static int32 ParallelCorrectionThreshold = 128;
+	FAutoConsoleVariableRef CVarParallelCorrectionThreshold(
+		TEXT("vrexp.PhysicsReplication.ParallelCorrectionThreshold"),
+		ParallelCorrectionThreshold,
+		TEXT("Number of replicated physics targets at which default replication corrections are computed in parallel before being applied.\n")
+		TEXT("Below this the targets are processed serially, 0 to always stay serial."),
+		ECVF_Default);
+
+	static int32 SleepEarlyOut = 1;
+	FAutoConsoleVariableRef CVarSleepEarlyOut(
+		TEXT("vrexp.PhysicsReplication.SleepEarlyOut"),
+		SleepEarlyOut,
+		TEXT("When on, replicated physics targets that are asleep, on a body that is locally asleep at the same pose, are dropped without running any correction.\n")
+		TEXT("0: Disable, 1: Enable"),
+		ECVF_Default);
+
+	static float SleepEarlyOutDistance = 1.0f;
+	FAutoConsoleVariableRef CVarSleepEarlyOutDistance(
+		TEXT("vrexp.PhysicsReplication.SleepEarlyOutDistance"),
+		SleepEarlyOutDistance,
+		TEXT("Max distance (cm) between a sleeping body and its sleeping target for them to be considered resting at the same pose."),
+		ECVF_Default);
+
+	static float SleepEarlyOutAngle = 1.0f;
+	FAutoConsoleVariableRef CVarSleepEarlyOutAngle(
+		TEXT("vrexp.PhysicsReplication.SleepEarlyOutAngle"),
+		SleepEarlyOutAngle,
+		TEXT("Max angle (degrees) between a sleeping body and its sleeping target for them to be considered resting at the same pose."),
+		ECVF_Default);
+
+	static int32 IslandReplication = 0;
+	FAutoConsoleVariableRef CVarIslandReplication(
+		TEXT("vrexp.PhysicsReplication.IslandReplication"),
+		IslandReplication,
+		TEXT("When on, replicated bodies sharing a simulation island (stacks, constrained assemblies) only correct the heaviest body in the island and let the solver settle the rest.\n")
+		TEXT("Resimulation targets are never grouped. 0: Disable, 1: Enable"),
+		ECVF_Default);
+
+	static float IslandFollowerMaxError = 10.0f;
+	FAutoConsoleVariableRef CVarIslandFollowerMaxError(
+		TEXT("vrexp.PhysicsReplication.IslandFollowerMaxError"),
+		IslandFollowerMaxError,
+		TEXT("Max distance (cm) a grouped body can be from its own target and still rely on the island's reference body, past this it is corrected on its own."),
+		ECVF_Default);
+
+	static int32 QuantizedMovementDirtying = 1;
+	FAutoConsoleVariableRef CVarQuantizedMovementDirtying(
+		TEXT("vrexp.PhysicsReplication.QuantizedMovementDirtying"),
+		QuantizedMovementDirtying,
+		TEXT("When on, grippable actors only mark ReplicatedMovement dirty when the gathered movement changed beyond its quantization precision.\n")
+		TEXT("0: Always mark dirty, 1: Enable"),
+		ECVF_Default);
+}
+
+DECLARE_STATS_GROUP(TEXT("VRPhysicsReplication"), STATGROUP_VRPhysicsReplication, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("VRPhysicsReplication OnTick"), STAT_VRPhysicsReplicationTick, STATGROUP_VRPhysicsReplication);
+DECLARE_CYCLE_STAT(TEXT("VRPhysicsReplication ApplyTargetStatesAsync"), STAT_VRPhysicsReplicationApplyAsync, STATGROUP_VRPhysicsReplication);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRPhysicsReplication Async Targets"), STAT_VRPhysicsReplicationAsyncTargets, STATGROUP_VRPhysicsReplication);
+
 // Hacky work around for them not exporting these....
 #if WITH_EDITOR
 namespace PhysicsReplicationCVars
@@ -149,6 +212,22 @@ void ComputeDeltasVR(const FVector& CurrentPos, const FQuat& CurrentQuat, const
 	OutAngDiffSize = FMath::Abs(OutAngDiff);
 }
 
+// True when both the replicated state and the local body are asleep at the same pose, in which case there is nothing to correct
+static bool IsRestingAtTargetVR(const bool bLocalSleeping, const FVector& CurrentPos, const FQuat& CurrentQuat, const FRigidBodyState& TargetState)
+{
+	if (!VRPhysicsReplicationCVars::SleepEarlyOut || !bLocalSleeping || !(TargetState.Flags & ERigidBodyFlags::Sleeping))
+	{
+		return false;
+	}
+
+	if (FVector::DistSquared(CurrentPos, FVector(TargetState.Position)) > FMath::Square(VRPhysicsReplicationCVars::SleepEarlyOutDistance))
+	{
+		return false;
+	}
+
+	return FMath::RadiansToDegrees(CurrentQuat.AngularDistance(TargetState.Quaternion)) <= VRPhysicsReplicationCVars::SleepEarlyOutAngle;
+}
+
 FPhysicsReplicationVR::FPhysicsReplicationVR(FPhysScene* PhysScene) :
 	FPhysicsReplication(PhysScene)
 {
@@ -694,6 +773,8 @@ bool FPhysicsReplicationVR::ApplyRigidBodyState(float DeltaSeconds, FBodyInstanc
 
 void FPhysicsReplicationVR::OnTick(float DeltaSeconds, TMap<TWeakObjectPtr<UPrimitiveComponent>, FReplicatedPhysicsTarget>& ComponentsToTargets)
 {
+	SCOPE_CYCLE_COUNTER(STAT_VRPhysicsReplicationTick);
+
 	// Skip all of the custom logic if we aren't the server
 	if (const UWorld* World = GetOwningWorld())
 	{
@@ -737,6 +818,13 @@ void FPhysicsReplicationVR::OnTick(float DeltaSeconds, TMap<TWeakObjectPtr<UPrim
 	// Get the ping between this PC & the server
 	const float LocalPing = 0.0f;//GetLocalPing();
 
+	const FVRPhysicsReplicationCorrectionProfile& CorrectionProfile = GetDefault<UVRGlobalSettings>()->PhysicsReplicationCorrectionProfile;
+	const bool bUseCorrectionProfile = CorrectionProfile.bUseAdaptiveErrorThresholds || CorrectionProfile.MaxCorrectionsPerFrame > 0;
+	if (bUseCorrectionProfile)
+	{
+		PrioritizeCorrections(ComponentsToTargets, CorrectionProfile);
+	}
+
 	for (auto Itr = ComponentsToTargets.CreateIterator(); Itr; ++Itr)
 	{
 		bool bRemoveItr = false;
@@ -780,10 +868,38 @@ void FPhysicsReplicationVR::OnTick(float DeltaSeconds, TMap<TWeakObjectPtr<UPrim
 							// NOTE: We divide by 2 to approximate 1-way ping from 2-way ping.
 							const float PingSecondsOneWay = 0.0f;// (LocalPing + OwnerPing) * 0.5f * 0.001f;
 
-							if (UpdatedState.Flags & ERigidBodyFlags::NeedsUpdate)
+							const bool bLocalSleeping = !BI->IsInstanceAwake();
+							const FTransform BodyTransform = bLocalSleeping ? BI->GetUnrealWorldTransform() : FTransform::Identity;
+							if (bLocalSleeping && IsRestingAtTargetVR(bLocalSleeping, BodyTransform.GetLocation(), BodyTransform.GetRotation(), UpdatedState))
 							{
+								// Both sides agree the body is resting, drop the target until a new state comes in
+								bRemoveItr = true;
+							}
+							else if (UpdatedState.Flags & ERigidBodyFlags::NeedsUpdate)
+							{
+								// The replicated body is moving again, wake right away rather than waiting on the correction to do it.
+								// Done ahead of the budget check so bodies that have to wait for their correction still start simulating.
+								if (bLocalSleeping && !(UpdatedState.Flags & ERigidBodyFlags::Sleeping))
+								{
+									BI->WakeInstance();
+								}
+
+								// Bodies that didn't make this frames correction budget keep their target and wait for the next frame
+								const float* ErrorScale = bUseCorrectionProfile ? CorrectionErrorScales.Find(PrimComp) : nullptr;
+								if (bUseCorrectionProfile && ErrorScale == nullptr)
+								{
+									continue;
+								}
+
+								FRigidBodyErrorCorrection BodyErrorCorrection = PhysicErrorCorrection;
+								if (ErrorScale)
+								{
+									BodyErrorCorrection.MaxRestoredStateError *= *ErrorScale;
+									BodyErrorCorrection.MaxLinearHardSnapDistance *= *ErrorScale;
+								}
+
 								const int32 LocalFrame = PhysicsTarget.ServerFrame - LocalFrameOffset;
-								const bool bRestoredState = ApplyRigidBodyState(DeltaSeconds, BI, PhysicsTarget, PhysicErrorCorrection, PingSecondsOneWay, LocalFrame, 0);
+								const bool bRestoredState = ApplyRigidBodyState(DeltaSeconds, BI, PhysicsTarget, BodyErrorCorrection, PingSecondsOneWay, LocalFrame, 0);
 
 								// Need to update the component to match new position.
 								static const auto CVarSkipSkeletalRepOptimization = IConsoleManager::Get().FindConsoleVariable(TEXT("p.SkipSkeletalRepOptimization"));
@@ -831,6 +947,89 @@ void FPhysicsReplicationVR::OnTick(float DeltaSeconds, TMap<TWeakObjectPtr<UPrim
 	AsyncInputVR = nullptr;
 }
 
+void FPhysicsReplicationVR::PrioritizeCorrections(const TMap<TWeakObjectPtr<UPrimitiveComponent>, FReplicatedPhysicsTarget>& ComponentsToTargets, const FVRPhysicsReplicationCorrectionProfile& CorrectionProfile)
+{
+	CorrectionErrorScales.Reset();
+	CorrectionCandidates.Reset();
+	ViewerLocations.Reset();
+
+	double CurrentTime = 0.0;
+	if (UWorld* World = GetOwningWorld())
+	{
+		CurrentTime = World->GetTimeSeconds();
+
+		for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+		{
+			const APlayerController* PlayerController = Iterator->Get();
+			if (const AActor* ViewTarget = PlayerController ? PlayerController->GetViewTarget() : nullptr)
+			{
+				ViewerLocations.Add(ViewTarget->GetActorLocation());
+			}
+		}
+	}
+
+	for (auto Itr = ComponentsToTargets.CreateConstIterator(); Itr; ++Itr)
+	{
+		UPrimitiveComponent* PrimComp = Itr.Key().Get();
+		const FReplicatedPhysicsTarget& PhysicsTarget = Itr.Value();
+		if (!PrimComp || PrimComp->GetAttachParent() != nullptr || !(PhysicsTarget.TargetState.Flags & ERigidBodyFlags::NeedsUpdate))
+		{
+			continue;
+		}
+
+		const FVector CurrentLocation = PrimComp->GetComponentLocation();
+		float NearestViewerDistanceSq = ViewerLocations.Num() > 0 ? UE_BIG_NUMBER : 0.0f;
+		for (const FVector& ViewerLocation : ViewerLocations)
+		{
+			NearestViewerDistanceSq = FMath::Min(NearestViewerDistanceSq, FVector::DistSquared(ViewerLocation, CurrentLocation));
+		}
+
+		const float NearestViewerDistance = FMath::Sqrt(NearestViewerDistanceSq);
+		const float BoundsRadius = PrimComp->Bounds.SphereRadius;
+
+		FCorrectionCandidateVR& Candidate = CorrectionCandidates.AddDefaulted_GetRef();
+		Candidate.Component = PrimComp;
+		Candidate.ErrorScale = CorrectionProfile.GetErrorScale(NearestViewerDistance, BoundsRadius);
+
+		// Approximate how visible the error is, positional error plus the arc the bounds sweep through from the rotational error, over the distance to the viewer
+		const float LinearError = FVector::Dist(CurrentLocation, PhysicsTarget.TargetState.Position);
+		const float AngularError = PrimComp->GetComponentQuat().AngularDistance(PhysicsTarget.TargetState.Quaternion) * BoundsRadius;
+		Candidate.Priority = (LinearError + AngularError) / FMath::Max(NearestViewerDistance, FMath::Max(CorrectionProfile.NearViewerDistance, 1.0f));
+
+		// Age the priority of bodies that were left out of previous frames budgets so they can't starve
+		if (const double* WaitStartTime = CorrectionWaitStartTimes.Find(PrimComp))
+		{
+			const float WaitTime = (float)FMath::Max(CurrentTime - *WaitStartTime, 0.0);
+			Candidate.Priority = (Candidate.Priority + UE_KINDA_SMALL_NUMBER) * (1.0f + (WaitTime * CorrectionProfile.WaitTimePriorityScale));
+		}
+	}
+
+	CorrectionWaitStartTimesScratch.Reset();
+	if (CorrectionProfile.MaxCorrectionsPerFrame > 0 && CorrectionCandidates.Num() > CorrectionProfile.MaxCorrectionsPerFrame)
+	{
+		CorrectionCandidates.Sort([](const FCorrectionCandidateVR& A, const FCorrectionCandidateVR& B)
+		{
+			return A.Priority > B.Priority;
+		});
+
+		// Bodies that didn't make the budget keep (or start) their wait time, everything else is dropped from the map
+		for (int32 Index = CorrectionProfile.MaxCorrectionsPerFrame; Index < CorrectionCandidates.Num(); ++Index)
+		{
+			const UPrimitiveComponent* WaitingComp = CorrectionCandidates[Index].Component;
+			const double* WaitStartTime = CorrectionWaitStartTimes.Find(WaitingComp);
+			CorrectionWaitStartTimesScratch.Add(WaitingComp, WaitStartTime ? *WaitStartTime : CurrentTime);
+		}
+
+		CorrectionCandidates.SetNum(CorrectionProfile.MaxCorrectionsPerFrame, EAllowShrinking::No);
+	}
+	Swap(CorrectionWaitStartTimes, CorrectionWaitStartTimesScratch);
+
+	for (const FCorrectionCandidateVR& Candidate : CorrectionCandidates)
+	{
+		CorrectionErrorScales.Add(Candidate.Component, Candidate.ErrorScale);
+	}
+}
+
 FRepMovementVR::FRepMovementVR() : FRepMovement()
 {
 	LocationQuantizationLevel = EVectorQuantization::RoundTwoDecimals;
@@ -862,9 +1061,122 @@ void FRepMovementVR::CopyTo(FRepMovement& other) const
 
 bool FRepMovementVR::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
+	const FVRRepMovementCompactSettings& CompactSettings = GetDefault<UVRGlobalSettings>()->RepMovementCompactSettings;
+
+	// Flag the mode so that the receiving end decodes correctly regardless of its own setting
+	uint8 bCompact = CompactSettings.bUseCompactSerialization ? 1 : 0;
+	Ar.SerializeBits(&bCompact, 1);
+
+	if (bCompact)
+	{
+		return NetSerializeCompact(Ar, Map, bOutSuccess, CompactSettings);
+	}
+
 	return FRepMovement::NetSerialize(Ar, Map, bOutSuccess);
 }
 
+namespace VRPhysicsReplicationStatics
+{
+	// Bounded per axis quantization, falls back to a 1 decimal packed vector if any axis is out of range
+	static bool SerializeBoundedVector(FArchive& Ar, FVector& Vector, float MaxValue, int32 NumBits)
+	{
+		MaxValue = FMath::Max(MaxValue, UE_KINDA_SMALL_NUMBER);
+		NumBits = FMath::Clamp(NumBits, 4, 24);
+
+		uint8 bInRange = 1;
+		if (Ar.IsSaving())
+		{
+			bInRange = FMath::Abs(Vector.X) <= MaxValue && FMath::Abs(Vector.Y) <= MaxValue && FMath::Abs(Vector.Z) <= MaxValue;
+		}
+
+		Ar.SerializeBits(&bInRange, 1);
+
+		if (!bInRange)
+		{
+			return SerializePackedVector<10, 24>(Vector, Ar);
+		}
+
+		// Even step count so that zero lands exactly on a step, resting objects decode to zero velocity
+		const uint32 MaxQuantized = (1u << NumBits) - 2;
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			uint32 Quantized = 0;
+			if (Ar.IsSaving())
+			{
+				Quantized = (uint32)FMath::RoundToInt(((Vector[Axis] / MaxValue) * 0.5f + 0.5f) * MaxQuantized);
+			}
+
+			Ar.SerializeBits(&Quantized, NumBits);
+
+			if (Ar.IsLoading())
+			{
+				Quantized = FMath::Min(Quantized, MaxQuantized);
+				Vector[Axis] = (((float)Quantized / (float)MaxQuantized) - 0.5f) * 2.0f * MaxValue;
+			}
+		}
+
+		return true;
+	}
+}
+
+bool FRepMovementVR::NetSerializeCompact(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess, const FVRRepMovementCompactSettings& CompactSettings)
+{
+	bOutSuccess = true;
+
+	uint8 Flags = (bSimulatedPhysicSleep << 0) | (bRepPhysics << 1);
+	Ar.SerializeBits(&Flags, 2);
+
+	if (Ar.IsLoading())
+	{
+		bSimulatedPhysicSleep = (Flags & (1 << 0)) ? 1 : 0;
+		bRepPhysics = (Flags & (1 << 1)) ? 1 : 0;
+	}
+
+	// Location is world space and not range bounded, keep the movements own quantization level for it
+	switch (LocationQuantizationLevel)
+	{
+	case EVectorQuantization::RoundWholeNumber: bOutSuccess &= SerializePackedVector<1, 24>(Location, Ar); break;
+	case EVectorQuantization::RoundOneDecimal: bOutSuccess &= SerializePackedVector<10, 27>(Location, Ar); break;
+	case EVectorQuantization::RoundTwoDecimals:
+	default: bOutSuccess &= SerializePackedVector<100, 30>(Location, Ar); break;
+	}
+
+	FQuat RotationQuat = Ar.IsSaving() ? Rotation.Quaternion() : FQuat::Identity;
+	FTransform_NetQuantize::SerializeQuat_SmallestThree<12>(Ar, RotationQuat);
+
+	bOutSuccess &= VRPhysicsReplicationStatics::SerializeBoundedVector(Ar, LinearVelocity, CompactSettings.MaxLinearVelocity, CompactSettings.LinearVelocityBits);
+
+	uint8 bHasAngularVelocity = 1;
+	if (Ar.IsSaving() && CompactSettings.bOmitSmallAngularVelocity)
+	{
+		bHasAngularVelocity = !AngularVelocity.IsNearlyZero(CompactSettings.AngularVelocityOmitThreshold);
+	}
+
+	Ar.SerializeBits(&bHasAngularVelocity, 1);
+
+	if (bHasAngularVelocity)
+	{
+		bOutSuccess &= VRPhysicsReplicationStatics::SerializeBoundedVector(Ar, AngularVelocity, CompactSettings.MaxAngularVelocity, CompactSettings.AngularVelocityBits);
+	}
+
+	uint32 PackedServerFrame = (uint32)ServerFrame;
+	Ar.SerializeIntPacked(PackedServerFrame);
+
+	if (Ar.IsLoading())
+	{
+		Rotation = RotationQuat.Rotator();
+		ServerFrame = (int32)PackedServerFrame;
+
+		if (!bHasAngularVelocity)
+		{
+			AngularVelocity = FVector::ZeroVector;
+		}
+	}
+
+	return bOutSuccess;
+}
+
 bool FRepMovementVR::GatherActorsMovement(AActor* OwningActor)
 {
 	//if (/*bReplicateMovement || (RootComponent && RootComponent->GetAttachParent())*/)
@@ -872,10 +1184,30 @@ bool FRepMovementVR::GatherActorsMovement(AActor* OwningActor)
 		UPrimitiveComponent* RootPrimComp = Cast<UPrimitiveComponent>(OwningActor->GetRootComponent());
 		if (RootPrimComp && RootPrimComp->IsSimulatingPhysics())
 		{
-			FRigidBodyState RBState;
-			RootPrimComp->GetRigidBodyState(RBState);
+			bool bFoundInCache = false;
+			int CachedServerFrame = 0;
+
+			// Prefer the scenes replication cache, it is filled in one pass over the physics results
+			// and saves a physics thread read per actor.
+			UWorld* World = OwningActor->GetWorld();
+			if (FPhysScene_Chaos* Scene = World ? static_cast<FPhysScene_Chaos*>(World->GetPhysicsScene()) : nullptr)
+			{
+				if (const FRigidBodyState* FoundState = Scene->GetStateFromReplicationCache(RootPrimComp, CachedServerFrame))
+				{
+					// These are client authed sends, the local physics frame means nothing to the server so leave ServerFrame at its default
+					FillFrom(*FoundState, OwningActor);
+					bFoundInCache = true;
+				}
+			}
+
+			if (!bFoundInCache)
+			{
+				// fallback to GT data
+				FRigidBodyState RBState;
+				RootPrimComp->GetRigidBodyState(RBState);
+				FillFrom(RBState, OwningActor);
+			}
 
-			FillFrom(RBState, OwningActor);
 			// Don't replicate movement if we're welded to another parent actor.
 			// Their replication will affect our position indirectly since we are attached.
 			bRepPhysics = !RootPrimComp->IsWelded();
@@ -914,28 +1246,264 @@ bool FRepMovementVR::GatherActorsMovement(AActor* OwningActor)
 	return true;
 }
 
+namespace VRPhysicsReplicationStatics
+{
+	static float GetVectorQuantizationStep(EVectorQuantization QuantizationLevel)
+	{
+		switch (QuantizationLevel)
+		{
+		case EVectorQuantization::RoundWholeNumber: return 1.0f;
+		case EVectorQuantization::RoundOneDecimal: return 0.1f;
+		case EVectorQuantization::RoundTwoDecimals:
+		default: return 0.01f;
+		}
+	}
+
+	static float GetRotationQuantizationStep(ERotatorQuantization QuantizationLevel)
+	{
+		switch (QuantizationLevel)
+		{
+		case ERotatorQuantization::ByteComponents: return 360.0f / 256.0f;
+		case ERotatorQuantization::ShortComponents:
+		default: return 360.0f / 65536.0f;
+		}
+	}
+}
+
+bool FRepMovementVR::HasChangedBeyondQuantization(const FRepMovement& Previous, const FRepMovement& Current, bool bCompareServerFrame)
+{
+	if (!VRPhysicsReplicationCVars::QuantizedMovementDirtying)
+	{
+		return true;
+	}
+
+	if (Previous.bRepPhysics != Current.bRepPhysics ||
+		Previous.bSimulatedPhysicSleep != Current.bSimulatedPhysicSleep ||
+		Previous.LocationQuantizationLevel != Current.LocationQuantizationLevel ||
+		Previous.VelocityQuantizationLevel != Current.VelocityQuantizationLevel ||
+		Previous.RotationQuantizationLevel != Current.RotationQuantizationLevel)
+	{
+		return true;
+	}
+
+	// Resimulation needs the frame even when the body is still
+	if (bCompareServerFrame && Previous.ServerFrame != Current.ServerFrame)
+	{
+		return true;
+	}
+
+	// Half a step, anything under this rounds to the same serialized value (or at most one step off on a boundary)
+	const float LocationTolerance = VRPhysicsReplicationStatics::GetVectorQuantizationStep(Current.LocationQuantizationLevel) * 0.5f;
+	const float VelocityTolerance = VRPhysicsReplicationStatics::GetVectorQuantizationStep(Current.VelocityQuantizationLevel) * 0.5f;
+	const float RotationTolerance = VRPhysicsReplicationStatics::GetRotationQuantizationStep(Current.RotationQuantizationLevel) * 0.5f;
+
+	return !Previous.Location.Equals(Current.Location, LocationTolerance) ||
+		!Previous.Rotation.Equals(Current.Rotation, RotationTolerance) ||
+		!Previous.LinearVelocity.Equals(Current.LinearVelocity, VelocityTolerance) ||
+		!Previous.AngularVelocity.Equals(Current.AngularVelocity, VelocityTolerance);
+}
+
+bool FVRClientAuthReplicationData::ShouldSendMovement(const FRepMovement& CurrentMovement, float CurrentTime, float GravityZ) const
+{
+	if (!bUseTrajectoryCompression || !bHasSentTrajectory)
+	{
+		return true;
+	}
+
+	// Predict where the server has simulated the object to since the last send, ballistic with no collision
+	const float DeltaTime = FMath::Max(CurrentTime - TimeAtLastSend, 0.0f);
+	const FVector PredictedLocation = LastSentMovement.Location + (LastSentMovement.LinearVelocity * DeltaTime) + FVector(0.0f, 0.0f, 0.5f * GravityZ * DeltaTime * DeltaTime);
+
+	if (FVector::DistSquared(PredictedLocation, CurrentMovement.Location) > FMath::Square(TrajectoryPositionErrorThreshold))
+	{
+		return true;
+	}
+
+	// Angular velocity is in degrees
+	FVector AngVelAxis;
+	float AngVelSize;
+	LastSentMovement.AngularVelocity.ToDirectionAndLength(AngVelAxis, AngVelSize);
+	const FQuat PredictedRotation = FQuat(AngVelAxis, FMath::DegreesToRadians(AngVelSize) * DeltaTime) * LastSentMovement.Rotation.Quaternion();
+
+	return FMath::RadiansToDegrees(PredictedRotation.AngularDistance(CurrentMovement.Rotation.Quaternion())) > TrajectoryRotationErrorThreshold;
+}
+
+void FVRClientAuthReplicationData::NotifyMovementSent(const FRepMovement& SentMovement, float CurrentTime)
+{
+	LastSentMovement = SentMovement;
+	TimeAtLastSend = CurrentTime;
+	bHasSentTrajectory = true;
+}
+
+bool FVRClientAuthReplicationData::SendMovementIfNeeded(AActor* OwningActor, bool bForceSend, TFunctionRef<void(const FRepMovementVR&)> SendFunc)
+{
+	UWorld* OurWorld = OwningActor ? OwningActor->GetWorld() : nullptr;
+	if (!OurWorld)
+		return false;
+
+	FRepMovementVR ClientAuthMovementRep;
+	if (!ClientAuthMovementRep.GatherActorsMovement(OwningActor))
+		return false;
+
+	float GravityZ = 0.0f;
+	if (UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(OwningActor->GetRootComponent()))
+	{
+		GravityZ = PrimComp->IsGravityEnabled() ? OurWorld->GetGravityZ() : 0.0f;
+	}
+
+	if (bForceSend || ShouldSendMovement(ClientAuthMovementRep, OurWorld->GetTimeSeconds(), GravityZ))
+	{
+		SendFunc(ClientAuthMovementRep);
+		NotifyMovementSent(ClientAuthMovementRep, OurWorld->GetTimeSeconds());
+	}
+
+	return true;
+}
+
+void FVRClientAuthReplicationData::ApplyReceivedMovement(AActor* OwningActor, const FRepMovementVR& NewMovement) const
+{
+	if (!OwningActor || NewMovement.Location.ContainsNaN() || NewMovement.Rotation.ContainsNaN())
+		return;
+
+	FRepMovement& MovementRep = OwningActor->GetReplicatedMovement_Mutable();
+	NewMovement.CopyTo(MovementRep);
+
+	UPrimitiveComponent* RootPrim = Cast<UPrimitiveComponent>(OwningActor->GetRootComponent());
+	if (!bUseTrajectoryCompression || !RootPrim || !RootPrim->IsSimulatingPhysics())
+	{
+		OwningActor->OnRep_ReplicatedMovement();
+		return;
+	}
+
+	// Sends are sparse with trajectory compression, a persistent replication target would keep dragging the body back
+	// to a stale non extrapolated state. Apply the state once and let the server simulate the ballistic path the client is predicting.
+	if (UWorld* World = OwningActor->GetWorld())
+	{
+		if (FPhysScene* PhysScene = World->GetPhysicsScene())
+		{
+			if (IPhysicsReplication* PhysicsReplication = PhysScene->GetPhysicsReplication())
+			{
+				PhysicsReplication->RemoveReplicatedTarget(RootPrim);
+			}
+		}
+	}
+
+	RootPrim->SetWorldLocationAndRotation(MovementRep.Location, MovementRep.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+	RootPrim->SetPhysicsLinearVelocity(MovementRep.LinearVelocity);
+	RootPrim->SetPhysicsAngularVelocityInDegrees(MovementRep.AngularVelocity);
+
+	if (MovementRep.bSimulatedPhysicSleep)
+	{
+		RootPrim->PutRigidBodyToSleep();
+	}
+	else
+	{
+		RootPrim->WakeRigidBody();
+	}
+}
 
 #pragma region FPhysicsReplicationAsync
 
 void FPhysicsReplicationAsyncVR::OnPhysicsObjectUnregistered_Internal(Chaos::FConstPhysicsObjectHandle PhysicsObject)
 {
-	ObjectToTarget.Remove(PhysicsObject);
-	ObjectToSettings.Remove(PhysicsObject);
+	RemoveTarget(PhysicsObject);
+	RemoveSettings(PhysicsObject);
 }
 
 void FPhysicsReplicationAsyncVR::RegisterSettings(Chaos::FConstPhysicsObjectHandle PhysicsObject, FNetworkPhysicsSettingsAsync InSettings)
 {
 	if (PhysicsObject != nullptr)
 	{
-		FNetworkPhysicsSettingsAsync& Settings = ObjectToSettings.FindOrAdd(PhysicsObject);
-		Settings = InSettings;
+		if (const int32* SettingsIndex = ObjectToSettingsIndex.Find(PhysicsObject))
+		{
+			Settings[*SettingsIndex] = InSettings;
+			return;
+		}
+
+		const int32 NewSettingsIndex = Settings.Add(InSettings);
+		SettingsObjects.Add(PhysicsObject);
+		ObjectToSettingsIndex.Add(PhysicsObject, NewSettingsIndex);
+
+		// Link an already existing target to its new settings
+		if (const int32* TargetIndex = ObjectToTargetIndex.Find(PhysicsObject))
+		{
+			TargetSettingsIndices[*TargetIndex] = NewSettingsIndex;
+		}
 	}
 }
 
-void FPhysicsReplicationAsyncVR::FetchObjectSettings(Chaos::FConstPhysicsObjectHandle PhysicsObject)
+void FPhysicsReplicationAsyncVR::FetchTargetSettings(int32 TargetIndex)
 {
-	FNetworkPhysicsSettingsAsync* CustomSettings = ObjectToSettings.Find(PhysicsObject);
-	SettingsCurrent = (CustomSettings != nullptr) ? *CustomSettings : SettingsDefault;
+	const int32 SettingsIndex = TargetSettingsIndices[TargetIndex];
+	SettingsCurrent = (SettingsIndex != INDEX_NONE) ? Settings[SettingsIndex] : SettingsDefault;
+}
+
+int32 FPhysicsReplicationAsyncVR::AddTarget(Chaos::FConstPhysicsObjectHandle PhysicsObject)
+{
+	const int32 TargetIndex = Targets.AddDefaulted();
+	TargetObjects.Add(PhysicsObject);
+	TargetExtrapolationCaches.AddDefaulted();
+
+	const int32* SettingsIndex = ObjectToSettingsIndex.Find(PhysicsObject);
+	TargetSettingsIndices.Add(SettingsIndex ? *SettingsIndex : INDEX_NONE);
+
+	ObjectToTargetIndex.Add(PhysicsObject, TargetIndex);
+	return TargetIndex;
+}
+
+void FPhysicsReplicationAsyncVR::RemoveTarget(Chaos::FConstPhysicsObjectHandle PhysicsObject)
+{
+	if (const int32* TargetIndex = ObjectToTargetIndex.Find(PhysicsObject))
+	{
+		RemoveTargetAtIndex(*TargetIndex);
+	}
+}
+
+void FPhysicsReplicationAsyncVR::RemoveTargetAtIndex(int32 TargetIndex)
+{
+	ObjectToTargetIndex.Remove(TargetObjects[TargetIndex]);
+
+	const int32 LastIndex = Targets.Num() - 1;
+	if (TargetIndex != LastIndex)
+	{
+		// The last target is moved into the freed slot, point its handle at the new index
+		ObjectToTargetIndex[TargetObjects[LastIndex]] = TargetIndex;
+	}
+
+	Targets.RemoveAtSwap(TargetIndex, 1, EAllowShrinking::No);
+	TargetObjects.RemoveAtSwap(TargetIndex, 1, EAllowShrinking::No);
+	TargetSettingsIndices.RemoveAtSwap(TargetIndex, 1, EAllowShrinking::No);
+	TargetExtrapolationCaches.RemoveAtSwap(TargetIndex, 1, EAllowShrinking::No);
+}
+
+void FPhysicsReplicationAsyncVR::RemoveSettings(Chaos::FConstPhysicsObjectHandle PhysicsObject)
+{
+	int32 SettingsIndex = INDEX_NONE;
+	if (!ObjectToSettingsIndex.RemoveAndCopyValue(PhysicsObject, SettingsIndex))
+	{
+		return;
+	}
+
+	if (const int32* TargetIndex = ObjectToTargetIndex.Find(PhysicsObject))
+	{
+		TargetSettingsIndices[*TargetIndex] = INDEX_NONE;
+	}
+
+	const int32 LastIndex = Settings.Num() - 1;
+	if (SettingsIndex != LastIndex)
+	{
+		// The last settings entry is moved into the freed slot, re-point its handle and any target using it
+		const Chaos::FConstPhysicsObjectHandle MovedObject = SettingsObjects[LastIndex];
+		ObjectToSettingsIndex[MovedObject] = SettingsIndex;
+
+		if (const int32* MovedTargetIndex = ObjectToTargetIndex.Find(MovedObject))
+		{
+			TargetSettingsIndices[*MovedTargetIndex] = SettingsIndex;
+		}
+	}
+
+	Settings.RemoveAtSwap(SettingsIndex, 1, EAllowShrinking::No);
+	SettingsObjects.RemoveAtSwap(SettingsIndex, 1, EAllowShrinking::No);
 }
 
 void FPhysicsReplicationAsyncVR::OnPostInitialize_Internal()
@@ -970,9 +1538,8 @@ void FPhysicsReplicationAsyncVR::OnPreSimulate_Internal()
 			static const auto CVarPostResimWaitForUpdate = IConsoleManager::Get().FindConsoleVariable(TEXT("np2.PredictiveInterpolation.PostResimWaitForUpdate"));
 			if (CVarPostResimWaitForUpdate->GetBool() && RewindData->IsFinalResim())
 			{
-				for (auto Itr = ObjectToTarget.CreateIterator(); Itr; ++Itr)
+				for (FReplicatedPhysicsTargetAsync& Target : Targets)
 				{
-					FReplicatedPhysicsTargetAsync& Target = Itr.Value();
 
 					// If final resim frame, mark interpolated targets as waiting for up to date data from the server.
 					if (Target.RepMode == EPhysicsReplicationMode::PredictiveInterpolation)
@@ -991,7 +1558,7 @@ void FPhysicsReplicationAsyncVR::OnPreSimulate_Internal()
 			if (Input.TargetState.Flags == ERigidBodyFlags::None)
 			{
 				// Remove replication target 
-				ObjectToTarget.Remove(Input.PhysicsObject);
+				RemoveTarget(Input.PhysicsObject);
 				continue;
 			}
 
@@ -1055,12 +1622,13 @@ void FPhysicsReplicationAsyncVR::UpdateAsyncTarget(const FPhysicsRepAsyncInputDa
 		return;
 	}
 
-	FReplicatedPhysicsTargetAsync* Target = ObjectToTarget.Find(Input.PhysicsObject);
-	bool bFirstTarget = Target == nullptr;
+	const int32* FoundTargetIndex = ObjectToTargetIndex.Find(Input.PhysicsObject);
+	bool bFirstTarget = FoundTargetIndex == nullptr;
+	const int32 TargetIndex = bFirstTarget ? AddTarget(Input.PhysicsObject) : *FoundTargetIndex;
+	FReplicatedPhysicsTargetAsync* Target = &Targets[TargetIndex];
 	if (bFirstTarget)
 	{
 		// First time we add a target, set previous state to current input
-		Target = &ObjectToTarget.Add(Input.PhysicsObject, FReplicatedPhysicsTargetAsync());
 		Target->PrevPos = Input.TargetState.Position;
 		Target->PrevPosTarget = Input.TargetState.Position;
 		Target->PrevRotTarget = Input.TargetState.Quaternion;
@@ -1129,6 +1697,7 @@ void FPhysicsReplicationAsyncVR::UpdateAsyncTarget(const FPhysicsRepAsyncInputDa
 			Target->ServerFrame = Input.ServerFrame;
 		Target->ReceiveFrame = CurrentFrame;
 		Target->TargetState = Input.TargetState;
+		TargetExtrapolationCaches[TargetIndex].StepSeconds = -1.0f; // New angular velocity, rebuild the step rotation on next use
 		Target->RepMode = Input.RepMode;
 		Target->FrameOffset = Input.FrameOffset;
 		Target->TickCount = 0;
@@ -1137,6 +1706,20 @@ void FPhysicsReplicationAsyncVR::UpdateAsyncTarget(const FPhysicsRepAsyncInputDa
 		// Update waiting state
 		Target->UpdateWaiting(Input.ServerFrame);
 
+		// A non sleeping state for a body that is resting locally, wake it immediately so the corrections aren't fighting sleep
+		if (!(Input.TargetState.Flags & ERigidBodyFlags::Sleeping))
+		{
+			Chaos::FReadPhysicsObjectInterface_Internal Interface = Chaos::FPhysicsObjectInternalInterface::GetRead();
+			if (Chaos::FGeometryParticleHandle* Handle = Interface.GetParticle(Input.PhysicsObject))
+			{
+				Chaos::FPBDRigidParticleHandle* RigidHandle = Handle->CastToRigidParticle();
+				if (RigidHandle && RigidHandle->IsSleeping())
+				{
+					RigidsSolver->GetEvolution()->SetParticleObjectState(RigidHandle, Chaos::EObjectStateType::Dynamic);
+				}
+			}
+		}
+
 		if (Input.RepMode == EPhysicsReplicationMode::PredictiveInterpolation)
 		{
 
@@ -1217,12 +1800,11 @@ void FPhysicsReplicationAsyncVR::CacheResimInteractions()
 	ParticlesInResimIslands.Empty(FMath::CeilToInt(static_cast<float>(ParticlesInResimIslands.Num()) * 0.9f));
 	Chaos::Private::FPBDIslandManager& IslandManager = RigidsSolver->GetEvolution()->GetIslandManager();
 	Chaos::FWritePhysicsObjectInterface_Internal Interface = Chaos::FPhysicsObjectInternalInterface::GetWrite();
-	for (auto Itr = ObjectToTarget.CreateIterator(); Itr; ++Itr)
+	for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
 	{
-		FReplicatedPhysicsTargetAsync& Target = Itr.Value();
-		if (Target.RepMode == EPhysicsReplicationMode::Resimulation)
+		if (Targets[TargetIndex].RepMode == EPhysicsReplicationMode::Resimulation)
 		{
-			Chaos::FConstPhysicsObjectHandle& POHandle = Itr.Key();
+			Chaos::FConstPhysicsObjectHandle POHandle = TargetObjects[TargetIndex];
 			if (Chaos::FGeometryParticleHandle* Handle = Interface.GetParticle(POHandle))
 			{
 				// Get a list of particles from the same island as a resim particle is in, i.e. particles interacting with a resim particle
@@ -1235,9 +1817,111 @@ void FPhysicsReplicationAsyncVR::CacheResimInteractions()
 	}
 }
 
+void FPhysicsReplicationAsyncVR::CacheIslandFollowers()
+{
+	IslandFollowers.Reset();
+	if (!VRPhysicsReplicationCVars::IslandReplication)
+	{
+		return;
+	}
+
+	Chaos::FPBDRigidsSolver* RigidsSolver = static_cast<Chaos::FPBDRigidsSolver*>(GetSolver());
+	if (RigidsSolver == nullptr)
+	{
+		return;
+	}
+
+	Chaos::FWritePhysicsObjectInterface_Internal Interface = Chaos::FPhysicsObjectInternalInterface::GetWrite();
+
+	// Only dynamic non resim bodies can be grouped, with fewer than two of them there is no island to share
+	IslandCandidateTargets.Reset();
+	for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+	{
+		const FReplicatedPhysicsTargetAsync& Target = Targets[TargetIndex];
+		if ((Target.IsWaiting() ? Target.RepModeOverride : Target.RepMode) == EPhysicsReplicationMode::Resimulation)
+		{
+			continue;
+		}
+
+		const Chaos::FGeometryParticleHandle* Handle = Interface.GetParticle(TargetObjects[TargetIndex]);
+		const Chaos::FPBDRigidParticleHandle* RigidHandle = Handle ? Handle->CastToRigidParticle() : nullptr;
+		if (RigidHandle && RigidHandle->ObjectState() == Chaos::EObjectStateType::Dynamic)
+		{
+			IslandCandidateTargets.Add(TargetIndex);
+		}
+	}
+
+	if (IslandCandidateTargets.Num() < 2)
+	{
+		return;
+	}
+
+	// One island lookup per candidate for the step, the island to reference map is built from these and reused for every follower
+	Chaos::Private::FPBDIslandManager& IslandManager = RigidsSolver->GetEvolution()->GetIslandManager();
+	TargetIslands.Init(INDEX_NONE, Targets.Num());
+	IslandReferenceTargets.Reset();
+	int32 NumGroupedTargets = 0;
+
+	// Pick the heaviest replicated dynamic body in each island as its reference
+	for (int32 TargetIndex : IslandCandidateTargets)
+	{
+		Chaos::FGeometryParticleHandle* Handle = Interface.GetParticle(TargetObjects[TargetIndex]);
+
+		// Only bodies in a single island, kinematics bridge islands and can't be settled by the solver
+		const TArray<int32> ParticleIslands = IslandManager.FindParticleIslands(Handle);
+		if (ParticleIslands.Num() != 1)
+		{
+			continue;
+		}
+
+		const int32 IslandIndex = ParticleIslands[0];
+		TargetIslands[TargetIndex] = IslandIndex;
+		++NumGroupedTargets;
+
+		if (int32* ReferenceIndex = IslandReferenceTargets.Find(IslandIndex))
+		{
+			const Chaos::FPBDRigidParticleHandle* ReferenceHandle = Interface.GetParticle(TargetObjects[*ReferenceIndex])->CastToRigidParticle();
+			if (Handle->CastToRigidParticle()->M() > ReferenceHandle->M())
+			{
+				*ReferenceIndex = TargetIndex;
+			}
+		}
+		else
+		{
+			IslandReferenceTargets.Add(IslandIndex, TargetIndex);
+		}
+	}
+
+	// Every island holds a single replicated body, nothing follows
+	if (NumGroupedTargets == IslandReferenceTargets.Num())
+	{
+		return;
+	}
+
+	// Everyone else in the island follows unless it has drifted too far from its own target for the solver to pull it back
+	IslandFollowers.Init(false, Targets.Num());
+	const float MaxFollowerErrorSq = FMath::Square(VRPhysicsReplicationCVars::IslandFollowerMaxError);
+	for (int32 TargetIndex : IslandCandidateTargets)
+	{
+		if (TargetIslands[TargetIndex] == INDEX_NONE || IslandReferenceTargets.FindChecked(TargetIslands[TargetIndex]) == TargetIndex)
+		{
+			continue;
+		}
+
+		const Chaos::FGeometryParticleHandle* Handle = Interface.GetParticle(TargetObjects[TargetIndex]);
+		IslandFollowers[TargetIndex] = FVector::DistSquared(FVector(Handle->GetX()), Targets[TargetIndex].TargetState.Position) <= MaxFollowerErrorSq;
+	}
+}
+
 void FPhysicsReplicationAsyncVR::ApplyTargetStatesAsync(const float DeltaSeconds, const FPhysicsRepErrorCorrectionData& ErrorCorrection, const TArray<FPhysicsRepAsyncInputData>& InputData)
 {
 	using namespace Chaos;
+	SCOPE_CYCLE_COUNTER(STAT_VRPhysicsReplicationApplyAsync);
+	SET_DWORD_STAT(STAT_VRPhysicsReplicationAsyncTargets, Targets.Num());
+
+	const bool bRecordSoak = VRPhysicsReplicationSoak::IsRecording();
+	const uint64 SoakStartCycles = bRecordSoak ? FPlatformTime::Cycles64() : 0;
+	TArray<float> SoakPositionErrors;
 
 	// Deprecated, legacy BodyInstance flow
 	for (const FPhysicsRepAsyncInputData& Input : InputData)
@@ -1254,26 +1938,90 @@ void FPhysicsReplicationAsyncVR::ApplyTargetStatesAsync(const float DeltaSeconds
 
 	// PhysicsObject flow
 	Chaos::FWritePhysicsObjectInterface_Internal Interface = Chaos::FPhysicsObjectInternalInterface::GetWrite();
-	for (auto Itr = ObjectToTarget.CreateIterator(); Itr; ++Itr)
+	DefaultParamsCurrent = GatherDefaultReplicationParams();
+	const FDefaultReplicationParams& DefaultParams = DefaultParamsCurrent;
+	CacheIslandFollowers();
+
+	// Default replication error / correction math is independent per body, with enough bodies compute it in parallel up front
+	// and only write the results to the particles in the serial pass below. The other modes talk to the solver and stay serial.
+	// Without a solver default replication only drops its targets, so there is nothing to compute
+	ParallelTargetIndices.Reset();
+	if (GetSolver() != nullptr && VRPhysicsReplicationCVars::ParallelCorrectionThreshold > 0 && Targets.Num() >= VRPhysicsReplicationCVars::ParallelCorrectionThreshold)
+	{
+		for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+		{
+			const FReplicatedPhysicsTargetAsync& Target = Targets[TargetIndex];
+			if ((Target.IsWaiting() ? Target.RepModeOverride : Target.RepMode) == EPhysicsReplicationMode::Default && !(IslandFollowers.Num() && IslandFollowers[TargetIndex]))
+			{
+				FGeometryParticleHandle* Handle = Interface.GetParticle(TargetObjects[TargetIndex]);
+				if (!Handle || !IsTargetResting(Handle->CastToRigidParticle(), Target))
+				{
+					ParallelTargetIndices.Add(TargetIndex);
+				}
+			}
+		}
+	}
+
+	const bool bParallelDefaultReplication = VRPhysicsReplicationCVars::ParallelCorrectionThreshold > 0 && ParallelTargetIndices.Num() >= VRPhysicsReplicationCVars::ParallelCorrectionThreshold;
+	if (bParallelDefaultReplication)
+	{
+		ParallelCorrections.SetNum(Targets.Num(), EAllowShrinking::No);
+		ParallelFor(ParallelTargetIndices.Num(), [this, &Interface, &DefaultParams, DeltaSeconds](int32 WorkIndex)
+		{
+			const int32 TargetIndex = ParallelTargetIndices[WorkIndex];
+			if (FGeometryParticleHandle* Handle = Interface.GetParticle(TargetObjects[TargetIndex]))
+			{
+				if (const FPBDRigidParticleHandle* RigidHandle = Handle->CastToRigidParticle())
+				{
+					ComputeDefaultReplication(RigidHandle, Targets[TargetIndex], DeltaSeconds, DefaultParams, ParallelCorrections[TargetIndex]);
+				}
+			}
+		});
+	}
+
+	// Walk backwards so that swap-removing the current target only ever moves an already processed one into its slot
+	for (int32 TargetIndex = Targets.Num() - 1; TargetIndex >= 0; --TargetIndex)
 	{
 		bool bRemoveItr = true; // Remove current cached replication target unless replication logic tells us to store it for next tick
 
-		Chaos::FConstPhysicsObjectHandle& POHandle = Itr.Key();
-		if (FGeometryParticleHandle* Handle = Interface.GetParticle(POHandle))
+		if (FGeometryParticleHandle* Handle = Interface.GetParticle(TargetObjects[TargetIndex]))
 		{
-			FReplicatedPhysicsTargetAsync& Target = Itr.Value();
+			FReplicatedPhysicsTargetAsync& Target = Targets[TargetIndex];
+
+
+			FPBDRigidParticleHandle* RigidHandle = Handle->CastToRigidParticle();
+			const EPhysicsReplicationMode RepMode = Target.IsWaiting() ? Target.RepModeOverride : Target.RepMode;
+
+			// If both sides agree the body is resting skip the correction entirely and drop the target until a new state comes in.
+			// Resimulation compares against past frames so it is left alone.
+			const bool bResting = RepMode != EPhysicsReplicationMode::Resimulation && IsTargetResting(RigidHandle, Target);
 
+			// Grouped into an island led by another replicated body, that body gets the correction and the solver settles this one.
+			// The target is kept and regrouped next step, if the solver hasn't pulled it within IslandFollowerMaxError by then it is corrected on its own.
+			const bool bIslandFollower = IslandFollowers.Num() && IslandFollowers[TargetIndex];
 
-			if (FPBDRigidParticleHandle* RigidHandle = Handle->CastToRigidParticle())
+			if (bRecordSoak && RigidHandle)
+			{
+				SoakPositionErrors.Add(FVector::Dist(FVector(RigidHandle->GetX()), Target.TargetState.Position));
+			}
+
+			if (RigidHandle && !bResting && !bIslandFollower)
 			{
 				// Cache custom settings for this object if there are any
-				FetchObjectSettings(POHandle);
+				FetchTargetSettings(TargetIndex);
+				ExtrapolationCacheCurrent = &TargetExtrapolationCaches[TargetIndex];
 
-				const EPhysicsReplicationMode RepMode = Target.IsWaiting() ? Target.RepModeOverride : Target.RepMode;
 				switch (RepMode)
 				{
 				case EPhysicsReplicationMode::Default:
-					bRemoveItr = DefaultReplication(RigidHandle, Target, DeltaSeconds);
+					if (bParallelDefaultReplication)
+					{
+						bRemoveItr = ApplyDefaultReplication(RigidHandle, ParallelCorrections[TargetIndex]);
+					}
+					else
+					{
+						bRemoveItr = DefaultReplication(RigidHandle, Target, DeltaSeconds, DefaultParams);
+					}
 					break;
 
 				case EPhysicsReplicationMode::PredictiveInterpolation:
@@ -1285,14 +2033,24 @@ void FPhysicsReplicationAsyncVR::ApplyTargetStatesAsync(const float DeltaSeconds
 					break;
 				}
 				Target.TickCount++;
+				ExtrapolationCacheCurrent = nullptr;
+			}
+			else if (bIslandFollower && !bResting)
+			{
+				bRemoveItr = false;
 			}
 		}
 
 		if (bRemoveItr)
 		{
-			Itr.RemoveCurrent();
+			RemoveTargetAtIndex(TargetIndex);
 		}
 	}
+
+	if (bRecordSoak)
+	{
+		VRPhysicsReplicationSoak::AddSamples(static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SoakStartCycles)), SoakPositionErrors);
+	}
 }
 
 //** Async function for legacy replication flow that goes partially through GT to then finishes in PT in this function. */
@@ -1349,19 +2107,90 @@ void FPhysicsReplicationAsyncVR::DefaultReplication_DEPRECATED(Chaos::FRigidBody
 }
 
 
-/** Default replication, run in simulation tick */
+bool FPhysicsReplicationAsyncVR::IsTargetResting(const Chaos::FPBDRigidParticleHandle* Handle, const FReplicatedPhysicsTargetAsync& Target) const
+{
+	return Handle && IsRestingAtTargetVR(Handle->IsSleeping(), Handle->GetX(), Handle->GetR(), Target.TargetState);
+}
+
+/** Resolve the default replication settings once per step, the compute pass can then run on worker threads without touching the console manager */
+FPhysicsReplicationAsyncVR::FDefaultReplicationParams FPhysicsReplicationAsyncVR::GatherDefaultReplicationParams() const
+{
+	FDefaultReplicationParams Params;
+
+	// Grab configuration variables from engine config or from CVars if overriding is turned on.
+	static const auto CVarNetPingExtrapolation = IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetPingExtrapolation"));
+	Params.NetPingExtrapolation = CVarNetPingExtrapolation->GetFloat() >= 0.0f ? CVarNetPingExtrapolation->GetFloat() : ErrorCorrectionDefault.PingExtrapolation;
+
+	static const auto CVarNetPingLimit = IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetPingLimit"));
+	Params.NetPingLimit = CVarNetPingLimit->GetFloat() > 0.0f ? CVarNetPingLimit->GetFloat() : ErrorCorrectionDefault.PingLimit;
+
+	static const auto CVarErrorPerLinearDifference = IConsoleManager::Get().FindConsoleVariable(TEXT("p.ErrorPerLinearDifference"));
+	Params.ErrorPerLinearDiff = CVarErrorPerLinearDifference->GetFloat() >= 0.0f ? CVarErrorPerLinearDifference->GetFloat() : ErrorCorrectionDefault.ErrorPerLinearDifference;
+
+	static const auto CVarErrorPerAngularDifference = IConsoleManager::Get().FindConsoleVariable(TEXT("p.ErrorPerAngularDifference"));
+	Params.ErrorPerAngularDiff = CVarErrorPerAngularDifference->GetFloat() >= 0.0f ? CVarErrorPerAngularDifference->GetFloat() : ErrorCorrectionDefault.ErrorPerAngularDifference;
+
+	static const auto CVarMaxRestoredStateError = IConsoleManager::Get().FindConsoleVariable(TEXT("p.MaxRestoredStateError"));
+	Params.MaxRestoredStateError = CVarMaxRestoredStateError->GetFloat() >= 0.0f ? CVarMaxRestoredStateError->GetFloat() : ErrorCorrectionDefault.MaxRestoredStateError;
+
+	static const auto CVarErrorAccumulation = IConsoleManager::Get().FindConsoleVariable(TEXT("p.ErrorAccumulationSeconds"));
+	Params.ErrorAccumulationSeconds = CVarErrorAccumulation->GetFloat() >= 0.0f ? CVarErrorAccumulation->GetFloat() : ErrorCorrectionDefault.ErrorAccumulationSeconds;
+
+	static const auto CVarErrorAccumulationDistanceSq = IConsoleManager::Get().FindConsoleVariable(TEXT("p.ErrorAccumulationDistanceSq"));
+	Params.ErrorAccumulationDistanceSq = CVarErrorAccumulationDistanceSq->GetFloat() >= 0.0f ? CVarErrorAccumulationDistanceSq->GetFloat() : ErrorCorrectionDefault.ErrorAccumulationDistanceSq;
+
+	static const auto CVarErrorAccumulationSimilarity = IConsoleManager::Get().FindConsoleVariable(TEXT("p.ErrorAccumulationSimilarity"));
+	Params.ErrorAccumulationSimilarity = CVarErrorAccumulationSimilarity->GetFloat() >= 0.0f ? CVarErrorAccumulationSimilarity->GetFloat() : ErrorCorrectionDefault.ErrorAccumulationSimilarity;
+
+	static const auto CVarLinSet = IConsoleManager::Get().FindConsoleVariable(TEXT("p.PositionLerp"));
+	Params.PositionLerp = CVarLinSet->GetFloat() >= 0.0f ? CVarLinSet->GetFloat() : ErrorCorrectionDefault.PositionLerp;
+
+	static const auto CVarLinLerp = IConsoleManager::Get().FindConsoleVariable(TEXT("p.LinearVelocityCoefficient"));
+	Params.LinearVelocityCoefficient = CVarLinLerp->GetFloat() >= 0.0f ? CVarLinLerp->GetFloat() : ErrorCorrectionDefault.LinearVelocityCoefficient;
+
+	static const auto CVarAngSet = IConsoleManager::Get().FindConsoleVariable(TEXT("p.AngleLerp"));
+	Params.AngleLerp = CVarAngSet->GetFloat() >= 0.0f ? CVarAngSet->GetFloat() : ErrorCorrectionDefault.AngleLerp;
+
+	static const auto CVarAngLerp = IConsoleManager::Get().FindConsoleVariable(TEXT("p.AngularVelocityCoefficient"));
+	Params.AngularVelocityCoefficient = CVarAngLerp->GetFloat() >= 0.0f ? CVarAngLerp->GetFloat() : ErrorCorrectionDefault.AngularVelocityCoefficient;
+
+	static const auto CVarMaxLinearHardSnapDistance = IConsoleManager::Get().FindConsoleVariable(TEXT("p.MaxLinearHardSnapDistance"));
+	Params.MaxLinearHardSnapDistance = CVarMaxLinearHardSnapDistance->GetFloat() >= 0.f ? CVarMaxLinearHardSnapDistance->GetFloat() : ErrorCorrectionDefault.MaxLinearHardSnapDistance;
+
+	static const auto CVarResimDisableReplicationOnInteraction = IConsoleManager::Get().FindConsoleVariable(TEXT("np2.Resim.DisableReplicationOnInteraction"));
+	Params.bDisableReplicationOnInteraction = CVarResimDisableReplicationOnInteraction->GetBool();
+
+	return Params;
+}
+
 bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHandle* Handle, FReplicatedPhysicsTargetAsync& Target, const float DeltaSeconds)
 {
-	Chaos::FPBDRigidsSolver* RigidsSolver = static_cast<Chaos::FPBDRigidsSolver*>(GetSolver());
-	if (RigidsSolver == nullptr)
+	return DefaultReplication(Handle, Target, DeltaSeconds, DefaultParamsCurrent);
+}
+
+/** Default replication, run in simulation tick */
+bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHandle* Handle, FReplicatedPhysicsTargetAsync& Target, const float DeltaSeconds, const FDefaultReplicationParams& Params)
+{
+	// Check before computing, the compute half updates the targets error accumulation
+	if (GetSolver() == nullptr)
 	{
 		return true;
 	}
 
-	static const auto CVarResimDisableReplicationOnInteraction = IConsoleManager::Get().FindConsoleVariable(TEXT("np2.Resim.DisableReplicationOnInteraction"));
-	if (CVarResimDisableReplicationOnInteraction->GetBool() && ParticlesInResimIslands.Contains(Handle->GetHandleIdx()))
+	FDefaultReplicationCorrection Correction;
+	ComputeDefaultReplication(Handle, Target, DeltaSeconds, Params, Correction);
+	return ApplyDefaultReplication(Handle, Correction);
+}
+
+/** Compute half of default replication, only reads the particle and writes to its own target so it is safe to run in parallel across bodies */
+void FPhysicsReplicationAsyncVR::ComputeDefaultReplication(const Chaos::FPBDRigidParticleHandle* Handle, FReplicatedPhysicsTargetAsync& Target, const float DeltaSeconds, const FDefaultReplicationParams& Params, FDefaultReplicationCorrection& OutCorrection) const
+{
+	OutCorrection = FDefaultReplicationCorrection();
+
+	if (Params.bDisableReplicationOnInteraction && ParticlesInResimIslands.Contains(Handle->GetHandleIdx()))
 	{
-		return false;
+		OutCorrection.bRestoredState = false;
+		return;
 	}
 
 	//
@@ -1395,7 +2224,6 @@ bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHand
 	//
 
 
-	bool bRestoredState = true;
 	const FRigidBodyState NewState = Target.TargetState;
 	const float NewQuatSizeSqr = NewState.Quaternion.SizeSquared();
 
@@ -1411,60 +2239,20 @@ bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHand
 	if (Handle == nullptr)
 	{
 		UE_LOG(LogPhysics, Warning, TEXT("Trying to replicate rigid state for non-rigid particle. (%s)"), *ObjectName);
-		return bRestoredState;
+		return;
 	}
 	else if (NewQuatSizeSqr < UE_KINDA_SMALL_NUMBER)
 	{
 		UE_LOG(LogPhysics, Warning, TEXT("Invalid zero quaternion set for body. (%s)"), *ObjectName);
-		return bRestoredState;
+		return;
 	}
 	else if (FMath::Abs(NewQuatSizeSqr - 1.f) > UE_KINDA_SMALL_NUMBER)
 	{
 		UE_LOG(LogPhysics, Warning, TEXT("Quaternion (%f %f %f %f) with non-unit magnitude detected. (%s)"),
 			NewState.Quaternion.X, NewState.Quaternion.Y, NewState.Quaternion.Z, NewState.Quaternion.W, *ObjectName);
-		return bRestoredState;
+		return;
 	}
 
-	// Grab configuration variables from engine config or from CVars if overriding is turned on.
-	static const auto CVarNetPingExtrapolation = IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetPingExtrapolation"));
-	const float NetPingExtrapolation = CVarNetPingExtrapolation->GetFloat() >= 0.0f ? CVarNetPingExtrapolation->GetFloat() : ErrorCorrectionDefault.PingExtrapolation;
-
-	static const auto CVarNetPingLimit = IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetPingLimit"));
-	const float NetPingLimit = CVarNetPingLimit->GetFloat() > 0.0f ? CVarNetPingLimit->GetFloat() : ErrorCorrectionDefault.PingLimit;
-
-	static const auto CVarErrorPerLinearDifference = IConsoleManager::Get().FindConsoleVariable(TEXT("p.ErrorPerLinearDifference"));
-	const float ErrorPerLinearDiff = CVarErrorPerLinearDifference->GetFloat() >= 0.0f ? CVarErrorPerLinearDifference->GetFloat() : ErrorCorrectionDefault.ErrorPerLinearDifference;
-
-	static const auto CVarErrorPerAngularDifference = IConsoleManager::Get().FindConsoleVariable(TEXT("p.ErrorPerAngularDifference"));
-	const float ErrorPerAngularDiff = CVarErrorPerAngularDifference->GetFloat() >= 0.0f ? CVarErrorPerAngularDifference->GetFloat() : ErrorCorrectionDefault.ErrorPerAngularDifference;
-
-	static const auto CVarMaxRestoredStateError = IConsoleManager::Get().FindConsoleVariable(TEXT("p.MaxRestoredStateError"));
-	const float MaxRestoredStateError = CVarMaxRestoredStateError->GetFloat() >= 0.0f ? CVarMaxRestoredStateError->GetFloat() : ErrorCorrectionDefault.MaxRestoredStateError;
-
-	static const auto CVarErrorAccumulation = IConsoleManager::Get().FindConsoleVariable(TEXT("p.ErrorAccumulationSeconds"));
-	const float ErrorAccumulationSeconds = CVarErrorAccumulation->GetFloat() >= 0.0f ? CVarErrorAccumulation->GetFloat() : ErrorCorrectionDefault.ErrorAccumulationSeconds;
-
-	static const auto CVarErrorAccumulationDistanceSq = IConsoleManager::Get().FindConsoleVariable(TEXT("p.ErrorAccumulationDistanceSq"));
-	const float ErrorAccumulationDistanceSq = CVarErrorAccumulationDistanceSq->GetFloat() >= 0.0f ? CVarErrorAccumulationDistanceSq->GetFloat() : ErrorCorrectionDefault.ErrorAccumulationDistanceSq;
-
-	static const auto CVarErrorAccumulationSimilarity = IConsoleManager::Get().FindConsoleVariable(TEXT("p.ErrorAccumulationSimilarity"));
-	const float ErrorAccumulationSimilarity = CVarErrorAccumulationSimilarity->GetFloat() >= 0.0f ? CVarErrorAccumulationSimilarity->GetFloat() : ErrorCorrectionDefault.ErrorAccumulationSimilarity;
-
-	static const auto CVarLinSet = IConsoleManager::Get().FindConsoleVariable(TEXT("p.PositionLerp"));
-	const float PositionLerp = CVarLinSet->GetFloat() >= 0.0f ? CVarLinSet->GetFloat() : ErrorCorrectionDefault.PositionLerp;
-
-	static const auto CVarLinLerp = IConsoleManager::Get().FindConsoleVariable(TEXT("p.LinearVelocityCoefficient"));
-	const float LinearVelocityCoefficient = CVarLinLerp->GetFloat() >= 0.0f ? CVarLinLerp->GetFloat() : ErrorCorrectionDefault.LinearVelocityCoefficient;
-
-	static const auto CVarAngSet = IConsoleManager::Get().FindConsoleVariable(TEXT("p.AngleLerp"));
-	const float AngleLerp = CVarAngSet->GetFloat() >= 0.0f ? CVarAngSet->GetFloat() : ErrorCorrectionDefault.AngleLerp;
-
-	static const auto CVarAngLerp = IConsoleManager::Get().FindConsoleVariable(TEXT("p.AngularVelocityCoefficient"));
-	const float AngularVelocityCoefficient = CVarAngLerp->GetFloat() >= 0.0f ? CVarAngLerp->GetFloat() : ErrorCorrectionDefault.AngularVelocityCoefficient;
-
-	static const auto CVarMaxLinearHardSnapDistance = IConsoleManager::Get().FindConsoleVariable(TEXT("p.MaxLinearHardSnapDistance"));
-	const float MaxLinearHardSnapDistance = CVarMaxLinearHardSnapDistance->GetFloat() >= 0.f ? CVarMaxLinearHardSnapDistance->GetFloat() : ErrorCorrectionDefault.MaxLinearHardSnapDistance;
-
 	// Get Current state
 	FRigidBodyState CurrentState;
 	CurrentState.Position = Handle->GetX();
@@ -1476,8 +2264,8 @@ bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHand
 	// Starting from the last known authoritative position, and
 	// extrapolate an approximation using the last known velocity
 	// and ping.
-	const float PingSeconds = FMath::Clamp(LatencyOneWay, 0.f, NetPingLimit);
-	const float ExtrapolationDeltaSeconds = PingSeconds * NetPingExtrapolation;
+	const float PingSeconds = FMath::Clamp(LatencyOneWay, 0.f, Params.NetPingLimit);
+	const float ExtrapolationDeltaSeconds = PingSeconds * Params.NetPingExtrapolation;
 	const FVector ExtrapolationDeltaPos = NewState.LinVel * ExtrapolationDeltaSeconds;
 	const FVector_NetQuantize100 TargetPos = NewState.Position + ExtrapolationDeltaPos;
 	float NewStateAngVel;
@@ -1498,14 +2286,12 @@ bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHand
 	/////// ACCUMULATE ERROR IF NOT APPROACHING SOLUTION ///////
 
 	// Store sleeping state
-	const bool bShouldSleep = (NewState.Flags & ERigidBodyFlags::Sleeping) != 0;
-	const bool bWasAwake = !Handle->Sleeping();
-	const bool bAutoWake = false;
+	OutCorrection.bShouldSleep = (NewState.Flags & ERigidBodyFlags::Sleeping) != 0;
 
-	const float Error = (LinDiffSize * ErrorPerLinearDiff) + (AngDiffSize * ErrorPerAngularDiff);
+	const float Error = (LinDiffSize * Params.ErrorPerLinearDiff) + (AngDiffSize * Params.ErrorPerAngularDiff);
 
-	bRestoredState = Error < MaxRestoredStateError;
-	if (bRestoredState)
+	OutCorrection.bRestoredState = Error < Params.MaxRestoredStateError;
+	if (OutCorrection.bRestoredState)
 	{
 		Target.AccumulatedErrorSeconds = 0.0f;
 	}
@@ -1544,8 +2330,8 @@ bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHand
 
 		// If the conditions from the heuristic outlined above are met, accumulate
 		// error. Otherwise, reduce it.
-		if (PrevProgress < ErrorAccumulationDistanceSq &&
-			PrevSimilarity > ErrorAccumulationSimilarity)
+		if (PrevProgress < Params.ErrorAccumulationDistanceSq &&
+			PrevSimilarity > Params.ErrorAccumulationSimilarity)
 		{
 			Target.AccumulatedErrorSeconds += DeltaSeconds;
 		}
@@ -1556,10 +2342,12 @@ bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHand
 
 		// Hard snap if error accumulation or linear error is big enough, and clear the error accumulator.
 		const bool bHardSnap =
-			LinDiffSize > MaxLinearHardSnapDistance ||
-			Target.AccumulatedErrorSeconds > ErrorAccumulationSeconds ||
+			LinDiffSize > Params.MaxLinearHardSnapDistance ||
+			Target.AccumulatedErrorSeconds > Params.ErrorAccumulationSeconds ||
 			CharacterMovementCVars::AlwaysHardSnap;
 
+		OutCorrection.bSetState = true;
+
 		if (bHardSnap)
 		{
 #if !UE_BUILD_SHIPPING
@@ -1569,7 +2357,7 @@ bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHand
 					*CurrentState.Position.ToString(), *TargetPos.ToString(), *CurrentState.LinVel.ToString(), *NewState.LinVel.ToString(),
 					*ExtrapolationDeltaPos.ToString(), Handle->Sleeping(), PrevProgress, PrevSimilarity);
 
-				if (LinDiffSize > MaxLinearHardSnapDistance)
+				if (LinDiffSize > Params.MaxLinearHardSnapDistance)
 				{
 					UE_LOG(LogTemp, Warning, TEXT("Hard snap due to linear difference error"));
 				}
@@ -1581,28 +2369,46 @@ bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHand
 #endif
 			// Too much error so just snap state here and be done with it
 			Target.AccumulatedErrorSeconds = 0.0f;
-			bRestoredState = true;
-			Handle->SetX(TargetPos);
-			Handle->SetR(TargetQuat);
-			Handle->SetV(NewState.LinVel);
-			Handle->SetW(FMath::DegreesToRadians(NewState.AngVel));
+			OutCorrection.bRestoredState = true;
+			OutCorrection.NewPos = TargetPos;
+			OutCorrection.NewRot = TargetQuat;
+			OutCorrection.NewLinVel = NewState.LinVel;
+			OutCorrection.NewAngVel = FMath::DegreesToRadians(NewState.AngVel);
 		}
 		else
 		{
-			const FVector NewLinVel = FVector(Target.TargetState.LinVel) + (LinDiff * LinearVelocityCoefficient * DeltaSeconds);
-			const FVector NewAngVel = FVector(Target.TargetState.AngVel) + (AngDiffAxis * AngDiff * AngularVelocityCoefficient * DeltaSeconds);
+			const FVector NewLinVel = FVector(Target.TargetState.LinVel) + (LinDiff * Params.LinearVelocityCoefficient * DeltaSeconds);
+			const FVector NewAngVel = FVector(Target.TargetState.AngVel) + (AngDiffAxis * AngDiff * Params.AngularVelocityCoefficient * DeltaSeconds);
 
-			const FVector NewPos = FMath::Lerp(FVector(CurrentState.Position), TargetPos, PositionLerp);
-			const FQuat NewAng = FQuat::Slerp(CurrentState.Quaternion, TargetQuat, AngleLerp);
-
-			Handle->SetX(NewPos);
-			Handle->SetR(NewAng);
-			Handle->SetV(NewLinVel);
-			Handle->SetW(FMath::DegreesToRadians(NewAngVel));
+			OutCorrection.NewPos = FMath::Lerp(FVector(CurrentState.Position), TargetPos, Params.PositionLerp);
+			OutCorrection.NewRot = FQuat::Slerp(CurrentState.Quaternion, TargetQuat, Params.AngleLerp);
+			OutCorrection.NewLinVel = NewLinVel;
+			OutCorrection.NewAngVel = FMath::DegreesToRadians(NewAngVel);
 		}
 	}
 
-	if (bShouldSleep)
+	Target.PrevPosTarget = TargetPos;
+	Target.PrevPos = FVector(CurrentState.Position);
+}
+
+/** Apply half of default replication, writes the computed correction to the particle, must run serially */
+bool FPhysicsReplicationAsyncVR::ApplyDefaultReplication(Chaos::FPBDRigidParticleHandle* Handle, const FDefaultReplicationCorrection& Correction)
+{
+	Chaos::FPBDRigidsSolver* RigidsSolver = static_cast<Chaos::FPBDRigidsSolver*>(GetSolver());
+	if (RigidsSolver == nullptr || Handle == nullptr)
+	{
+		return true;
+	}
+
+	if (Correction.bSetState)
+	{
+		Handle->SetX(Correction.NewPos);
+		Handle->SetR(Correction.NewRot);
+		Handle->SetV(Correction.NewLinVel);
+		Handle->SetW(Correction.NewAngVel);
+	}
+
+	if (Correction.bShouldSleep)
 	{
 		// don't allow kinematic to sleeping transition
 		if (Handle->ObjectState() != Chaos::EObjectStateType::Kinematic)
@@ -1611,10 +2417,7 @@ bool FPhysicsReplicationAsyncVR::DefaultReplication(Chaos::FPBDRigidParticleHand
 		}
 	}
 
-	Target.PrevPosTarget = TargetPos;
-	Target.PrevPos = FVector(CurrentState.Position);
-
-	return bRestoredState;
+	return Correction.bRestoredState;
 }
 
 /** Interpolating towards replicated states from the server while predicting local physics
@@ -1666,7 +2469,8 @@ bool FPhysicsReplicationAsyncVR::PredictiveInterpolation(Chaos::FPBDRigidParticl
 	Target.AccumulatedSleepSeconds = bIsSleeping ? (Target.AccumulatedSleepSeconds + DeltaSeconds) : 0.0f;
 
 	// Helper for sleep and target clearing at replication end
-	auto EndReplicationHelper = [RigidsSolver, Handle, bCanSimulate, bIsSleeping, DeltaSeconds](FReplicatedPhysicsTargetAsync& Target, bool bOkToClear) -> bool
+	FTargetExtrapolationCache* ExtrapolationCache = ExtrapolationCacheCurrent;
+	auto EndReplicationHelper = [RigidsSolver, Handle, bCanSimulate, bIsSleeping, DeltaSeconds, ExtrapolationCache](FReplicatedPhysicsTargetAsync& Target, bool bOkToClear) -> bool
 	{
 		const bool bShouldSleep = (Target.TargetState.Flags & ERigidBodyFlags::Sleeping) != 0;
 		const bool bReplicatingPhysics = (Target.TargetState.Flags & ERigidBodyFlags::RepPhysics) != 0;
@@ -1696,7 +2500,7 @@ bool FPhysicsReplicationAsyncVR::PredictiveInterpolation(Chaos::FPBDRigidParticl
 				FMath::CeilToInt(CVarExtrapolationMinTime->GetFloat() / DeltaSeconds)); // At least extrapolate for N seconds
 			if (Target.TickCount <= ExtrapolationTickLimit)
 			{
-				FPhysicsReplicationAsyncVR::ExtrapolateTarget(Target, 1, DeltaSeconds);
+				ExtrapolateTargetStep(Target, ExtrapolationCache, DeltaSeconds);
 			}
 		}
 
@@ -1976,6 +2780,29 @@ void FPhysicsReplicationAsyncVR::ExtrapolateTarget(FReplicatedPhysicsTargetAsync
 	Target.TargetState.Quaternion = TargetRotExtrapDelta * Target.TargetState.Quaternion;
 }
 
+/** Extrapolate a target by a single tick, reusing the cached per step rotation while its angular velocity and the step time are unchanged */
+void FPhysicsReplicationAsyncVR::ExtrapolateTargetStep(FReplicatedPhysicsTargetAsync& Target, FTargetExtrapolationCache* ExtrapolationCache, const float DeltaSeconds)
+{
+	if (ExtrapolationCache == nullptr)
+	{
+		FPhysicsReplicationAsyncVR::ExtrapolateTarget(Target, 1, DeltaSeconds);
+		return;
+	}
+
+	FTargetExtrapolationCache& Cache = *ExtrapolationCache;
+	if (Cache.StepSeconds != DeltaSeconds)
+	{
+		float TargetAngVelSize;
+		FVector TargetAngVelAxis;
+		Target.TargetState.AngVel.FVector::ToDirectionAndLength(TargetAngVelAxis, TargetAngVelSize);
+		Cache.StepRotation = FQuat(TargetAngVelAxis, FMath::DegreesToRadians(TargetAngVelSize) * DeltaSeconds);
+		Cache.StepSeconds = DeltaSeconds;
+	}
+
+	Target.TargetState.Position = Target.TargetState.Position + Target.TargetState.LinVel * DeltaSeconds;
+	Target.TargetState.Quaternion = Cache.StepRotation * Target.TargetState.Quaternion;
+}
+
 /** Compare states and trigger resimulation if needed */
 bool FPhysicsReplicationAsyncVR::ResimulationReplication(Chaos::FPBDRigidParticleHandle* Handle, FReplicatedPhysicsTargetAsync& Target, const float DeltaSeconds)
 {
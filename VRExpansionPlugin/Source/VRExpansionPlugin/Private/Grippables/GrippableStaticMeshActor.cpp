@@ -247,8 +247,9 @@ void AGrippableStaticMeshActor::GatherCurrentMovement()
 				}
 			}
 
-			// Technically, the values might have stayed the same, but we'll just assume they've changed.
-			bWasRepMovementModified = true;
+			// Only dirty the property if the body moved enough to serialize differently, resting bodies cost nothing to broadcast.
+			// Non default replication modes need the server frame even when still.
+			bWasRepMovementModified = FRepMovementVR::HasChangedBeyondQuantization(LastDirtiedRepMovement, RepMovement, GetPhysicsReplicationMode() != EPhysicsReplicationMode::Default);
 
 #if UE_WITH_IRIS
 			// If RepPhysics has changed value then notify the ReplicationSystem
@@ -286,13 +287,18 @@ void AGrippableStaticMeshActor::GatherCurrentMovement()
 				RepMovement.LinearVelocity = GetVelocity();
 				RepMovement.AngularVelocity = FVector::ZeroVector;
 
-				// Technically, the values might have stayed the same, but we'll just assume they've changed.
-				bWasRepMovementModified = true;
+				bWasRepMovementModified = FRepMovementVR::HasChangedBeyondQuantization(LastDirtiedRepMovement, RepMovement, false);
 			}
 
 			bWasRepMovementModified = (bWasRepMovementModified || RepMovement.bRepPhysics);
 			RepMovement.bRepPhysics = false;
 		}
+
+		if (bWasRepMovementModified)
+		{
+			LastDirtiedRepMovement = RepMovement;
+		}
+
 #if WITH_PUSH_MODEL
 		if (bWasRepMovementModified)
 		{
@@ -449,6 +455,7 @@ bool AGrippableStaticMeshActor::AddToClientReplicationBucket()
 		// The subsystem automatically removes entries with the same function signature so its safe to just always add here
 		GetWorld()->GetSubsystem<UBucketUpdateSubsystem>()->AddObjectToBucket(ClientAuthReplicationData.UpdateRate, this, FName(TEXT("PollReplicationEvent")));
 		ClientAuthReplicationData.bIsCurrentlyClientAuth = true;
+		ClientAuthReplicationData.ResetTrajectory();
 
 		if (UWorld * World = GetWorld())
 			ClientAuthReplicationData.TimeAtInitialThrow = World->GetTimeSeconds();
@@ -531,6 +538,7 @@ bool AGrippableStaticMeshActor::PollReplicationEvent()
 		return false; // Tell the bucket subsystem to remove us from consideration
 
 	bool bRemoveBlocking = false;
+	auto SendMovement = [this](const FRepMovementVR& MovementRep) { Server_GetClientAuthReplication(MovementRep); };
 
 	if ((OurWorld->GetTimeSeconds() - ClientAuthReplicationData.TimeAtInitialThrow) > 10.0f)
 	{
@@ -538,6 +546,12 @@ bool AGrippableStaticMeshActor::PollReplicationEvent()
 		// Authed movement that is forcing it to keep momentum.
 		//return false; // Tell the bucket subsystem to remove us from consideration
 		bRemoveBlocking = true;
+
+		// With trajectory compression the server is still simulating the last trajectory it was sent, give it the final state
+		if (ClientAuthReplicationData.bUseTrajectoryCompression && ShouldWeSkipAttachmentReplication(false))
+		{
+			ClientAuthReplicationData.SendMovementIfNeeded(this, true, SendMovement);
+		}
 	}
 
 	// Store current transform for resting check
@@ -554,15 +568,12 @@ bool AGrippableStaticMeshActor::PollReplicationEvent()
 				// Need to clamp to a max time since start, to handle cases with conflicting collisions
 				if (PrimComp->IsSimulatingPhysics() && ShouldWeSkipAttachmentReplication(false))
 				{
-					FRepMovementVR ClientAuthMovementRep;
-					if (ClientAuthMovementRep.GatherActorsMovement(this))
-					{
-						Server_GetClientAuthReplication(ClientAuthMovementRep);
+					const bool bIsAwake = PrimComp->RigidBodyIsAwake();
 
-						if (PrimComp->RigidBodyIsAwake())
-						{
-							return true;
-						}
+					// Always send the final state, otherwise only send if we drifted from the trajectory the server is predicting
+					if (ClientAuthReplicationData.SendMovementIfNeeded(this, !bIsAwake, SendMovement) && bIsAwake)
+					{
+						return true;
 					}
 				}
 			}
@@ -572,6 +583,14 @@ bool AGrippableStaticMeshActor::PollReplicationEvent()
 				//return false; // Tell the bucket subsystem to remove us from consideration
 			}
 		}
+		else if (ClientAuthReplicationData.bUseTrajectoryCompression && ClientAuthReplicationData.bHasSentTrajectory)
+		{
+			// Came to rest without sleeping, the server is still predicting along the last trajectory so send the resting state
+			if (ShouldWeSkipAttachmentReplication(false))
+			{
+				ClientAuthReplicationData.SendMovementIfNeeded(this, true, SendMovement);
+			}
+		}
 		//else
 	//	{
 			// Difference is too small, lets end sending location
@@ -626,6 +645,7 @@ void AGrippableStaticMeshActor::CeaseReplicationBlocking()
 		ClientAuthReplicationData.bIsCurrentlyClientAuth = false;
 
 	ClientAuthReplicationData.LastActorTransform = FTransform::Identity;
+	ClientAuthReplicationData.ResetTrajectory();
 
 	if (ClientAuthReplicationData.ResetReplicationHandle.IsValid())
 	{
@@ -680,12 +700,7 @@ void AGrippableStaticMeshActor::Server_GetClientAuthReplication_Implementation(c
 {
 	if (!VRGripInterfaceSettings.bIsHeld)
 	{
-		if (!newMovement.Location.ContainsNaN() && !newMovement.Rotation.ContainsNaN())
-		{
-			FRepMovement& MovementRep = GetReplicatedMovement_Mutable();
-			newMovement.CopyTo(MovementRep);
-			OnRep_ReplicatedMovement();
-		}
+		ClientAuthReplicationData.ApplyReceivedMovement(this, newMovement);
 	}
 }
 
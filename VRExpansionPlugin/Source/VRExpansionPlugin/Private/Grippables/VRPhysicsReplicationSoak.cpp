@@ -0,0 +1,240 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grippables/VRPhysicsReplicationSoak.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Engine/World.h"
+#include "Engine/NetDriver.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/CollisionProfile.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+#include "Grippables/GrippableStaticMeshActor.h"
+#include "Misc/VRSampleReservoir.h"
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogVRPhysicsReplicationSoak, Log, All);
+
+namespace VRPhysicsReplicationSoak
+{
+	// Samples kept for the percentiles, the counts keep going past this
+	static const int32 MaxSamples = 65536;
+
+	static std::atomic<bool> bRecording(false);
+	static FCriticalSection SampleLock;
+	static FVRSampleReservoir StepMilliseconds(MaxSamples);
+	static FVRSampleReservoir PositionErrors(MaxSamples);
+	static double StartTime = 0.0;
+	static uint64 StartInBytes = 0;
+	static uint64 StartOutBytes = 0;
+
+	// Bodies spawned by SoakSpawn, game thread only
+	static TArray<TWeakObjectPtr<AActor>> SpawnedBodies;
+	static FTimerHandle KickTimerHandle;
+	static TWeakObjectPtr<UWorld> KickWorld;
+
+	bool IsRecording()
+	{
+		return bRecording;
+	}
+
+	void AddSamples(float StepMs, const TArray<float>& StepErrors)
+	{
+		FScopeLock Lock(&SampleLock);
+		StepMilliseconds.Add(StepMs);
+		for (float StepError : StepErrors)
+		{
+			PositionErrors.Add(StepError);
+		}
+	}
+
+	static void LogPercentiles(const TCHAR* Name, FVRSampleReservoir& Reservoir)
+	{
+		const uint64 NumSeen = Reservoir.GetNumSeen();
+		const TArray<float> Samples = Reservoir.ConsumeSorted();
+		UE_LOG(LogVRPhysicsReplicationSoak, Log, TEXT("VRPhysicsReplication Soak: %s samples=%llu p50=%.3f p95=%.3f p99=%.3f max=%.3f"), Name, NumSeen,
+			FVRSampleReservoir::GetPercentile(Samples, 0.5f), FVRSampleReservoir::GetPercentile(Samples, 0.95f), FVRSampleReservoir::GetPercentile(Samples, 0.99f), Samples.Num() ? Samples.Last() : 0.0f);
+	}
+
+	static void StartRecording(UWorld* World)
+	{
+		{
+			FScopeLock Lock(&SampleLock);
+			StepMilliseconds.Reset();
+			PositionErrors.Reset();
+		}
+
+		const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+		StartInBytes = NetDriver ? NetDriver->InTotalBytes : 0;
+		StartOutBytes = NetDriver ? NetDriver->OutTotalBytes : 0;
+		StartTime = FPlatformTime::Seconds();
+		bRecording = true;
+	}
+
+	static void ClearSpawnedBodies()
+	{
+		if (UWorld* World = KickWorld.Get())
+		{
+			World->GetTimerManager().ClearTimer(KickTimerHandle);
+		}
+		KickWorld.Reset();
+
+		for (const TWeakObjectPtr<AActor>& Body : SpawnedBodies)
+		{
+			if (AActor* BodyActor = Body.Get())
+			{
+				BodyActor->Destroy();
+			}
+		}
+		SpawnedBodies.Reset();
+	}
+
+	static void KickBodies(float ImpulseStrength)
+	{
+		for (const TWeakObjectPtr<AActor>& Body : SpawnedBodies)
+		{
+			AActor* BodyActor = Body.Get();
+			UPrimitiveComponent* PrimComp = BodyActor ? Cast<UPrimitiveComponent>(BodyActor->GetRootComponent()) : nullptr;
+			if (PrimComp && PrimComp->IsSimulatingPhysics())
+			{
+				const FVector Impulse = FVector(FMath::FRandRange(-1.0f, 1.0f), FMath::FRandRange(-1.0f, 1.0f), FMath::FRandRange(0.5f, 1.0f)) * ImpulseStrength;
+				PrimComp->AddImpulse(Impulse, NAME_None, true);
+				PrimComp->AddAngularImpulseInDegrees(FMath::VRand() * ImpulseStrength, NAME_None, true);
+			}
+		}
+	}
+
+	static void SetNetEmulation(const TCHAR* Name, int32 Value)
+	{
+		if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(Name))
+		{
+			CVar->Set(Value, ECVF_SetByConsole);
+		}
+		else
+		{
+			UE_LOG(LogVRPhysicsReplicationSoak, Warning, TEXT("VRPhysicsReplication Soak: %s is not available in this build, net emulation is not applied"), Name);
+		}
+	}
+
+	static FAutoConsoleCommandWithWorld SoakStartCommand(
+		TEXT("vrexp.PhysicsReplication.SoakStart"),
+		TEXT("Start recording physics thread replication ms per step, positional error and net bytes for vrexp.PhysicsReplication.SoakReport."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			StartRecording(World);
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs SoakSpawnCommand(
+		TEXT("vrexp.PhysicsReplication.SoakSpawn"),
+		TEXT("Server only. vrexp.PhysicsReplication.SoakSpawn NumBodies [LagMs] [LossPercent] [KickInterval]\n")
+		TEXT("Spawns NumBodies replicated physics cubes above the first player, kicks them every KickInterval seconds (default 2) so they keep moving, ")
+		TEXT("applies NetEmulation.PktLag / NetEmulation.PktLoss to this process and starts recording. Run it again with 0 bodies to clean up.\n")
+		TEXT("Clients record their own side with vrexp.PhysicsReplication.SoakStart, they can apply their own emulation as well."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World || World->GetNetMode() == NM_Client)
+			{
+				UE_LOG(LogVRPhysicsReplicationSoak, Warning, TEXT("VRPhysicsReplication Soak: SoakSpawn has to be run on the server"));
+				return;
+			}
+
+			ClearSpawnedBodies();
+
+			const int32 NumBodies = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 0) : 0;
+			const int32 LagMs = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 0) : 0;
+			const int32 LossPercent = Args.Num() > 2 ? FMath::Clamp(FCString::Atoi(*Args[2]), 0, 100) : 0;
+			const float KickInterval = Args.Num() > 3 ? FMath::Max(FCString::Atof(*Args[3]), 0.1f) : 2.0f;
+
+			SetNetEmulation(TEXT("NetEmulation.PktLag"), LagMs);
+			SetNetEmulation(TEXT("NetEmulation.PktLoss"), LossPercent);
+
+			if (NumBodies <= 0)
+			{
+				return;
+			}
+
+			UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+			if (!CubeMesh)
+			{
+				UE_LOG(LogVRPhysicsReplicationSoak, Warning, TEXT("VRPhysicsReplication Soak: could not load /Engine/BasicShapes/Cube"));
+				return;
+			}
+
+			FVector Origin = FVector::ZeroVector;
+			if (APlayerController* PlayerController = World->GetFirstPlayerController())
+			{
+				if (const AActor* ViewTarget = PlayerController->GetViewTarget())
+				{
+					Origin = ViewTarget->GetActorLocation();
+				}
+			}
+
+			// Square grid with some spacing so that they start apart and pile up as they get kicked around
+			const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)NumBodies));
+			const float Spacing = 150.0f;
+			const FVector GridStart = Origin + FVector(-0.5f * GridSize * Spacing, -0.5f * GridSize * Spacing, 300.0f);
+
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			for (int32 BodyIndex = 0; BodyIndex < NumBodies; ++BodyIndex)
+			{
+				const FVector SpawnLocation = GridStart + FVector((BodyIndex % GridSize) * Spacing, (BodyIndex / GridSize) * Spacing, 0.0f);
+				AGrippableStaticMeshActor* Body = World->SpawnActor<AGrippableStaticMeshActor>(SpawnLocation, FRotator::ZeroRotator, SpawnParams);
+				if (!Body)
+				{
+					continue;
+				}
+
+				UStaticMeshComponent* MeshComp = Body->GetStaticMeshComponent();
+				// Clients need the mesh for a body to replicate to
+				MeshComp->SetIsReplicated(true);
+				MeshComp->SetStaticMesh(CubeMesh);
+				MeshComp->SetWorldScale3D(FVector(0.5f));
+				MeshComp->SetCollisionProfileName(UCollisionProfile::PhysicsActor_ProfileName);
+				MeshComp->SetSimulatePhysics(true);
+				SpawnedBodies.Add(Body);
+			}
+
+			KickWorld = World;
+			World->GetTimerManager().SetTimer(KickTimerHandle, FTimerDelegate::CreateLambda([]()
+			{
+				KickBodies(400.0f);
+			}), KickInterval, true);
+
+			UE_LOG(LogVRPhysicsReplicationSoak, Log, TEXT("VRPhysicsReplication Soak: spawned %d bodies, lag=%dms loss=%d%% kick interval=%.2fs"), SpawnedBodies.Num(), LagMs, LossPercent, KickInterval);
+			StartRecording(World);
+		}));
+
+	static FAutoConsoleCommandWithWorld SoakReportCommand(
+		TEXT("vrexp.PhysicsReplication.SoakReport"),
+		TEXT("Stop recording and log the physics replication soak results (ms per step, positional error cm percentiles, bytes per second)."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (!bRecording)
+			{
+				UE_LOG(LogVRPhysicsReplicationSoak, Warning, TEXT("VRPhysicsReplication Soak: not recording, run vrexp.PhysicsReplication.SoakStart first"));
+				return;
+			}
+
+			bRecording = false;
+			const double Duration = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+
+			{
+				FScopeLock Lock(&SampleLock);
+				UE_LOG(LogVRPhysicsReplicationSoak, Log, TEXT("VRPhysicsReplication Soak: duration=%.2fs bodies=%d"), Duration, SpawnedBodies.Num());
+				LogPercentiles(TEXT("PhysicsThreadMsPerStep"), StepMilliseconds);
+				LogPercentiles(TEXT("PositionErrorCm"), PositionErrors);
+			}
+
+			if (const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr)
+			{
+				UE_LOG(LogVRPhysicsReplicationSoak, Log, TEXT("VRPhysicsReplication Soak: InBytesPerSecond=%.1f OutBytesPerSecond=%.1f"),
+					(NetDriver->InTotalBytes - StartInBytes) / Duration, (NetDriver->OutTotalBytes - StartOutBytes) / Duration);
+			}
+		}));
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,22 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Soak measurement of the physics replication cost, usable in any session including -nullrhi dedicated servers / clients
+// vrexp.PhysicsReplication.SoakStart begins recording, vrexp.PhysicsReplication.SoakReport logs the results since then
+// vrexp.PhysicsReplication.SoakSpawn sets up a load (N kicked bodies plus net emulation) on the server to measure against
+// None of it exists in shipping builds
+namespace VRPhysicsReplicationSoak
+{
+#if !UE_BUILD_SHIPPING
+	bool IsRecording();
+
+	// Physics thread, one replication step's cost and the positional errors of its targets
+	void AddSamples(float StepMs, const TArray<float>& StepErrors);
+#else
+	inline bool IsRecording() { return false; }
+	inline void AddSamples(float StepMs, const TArray<float>& StepErrors) {}
+#endif
+}
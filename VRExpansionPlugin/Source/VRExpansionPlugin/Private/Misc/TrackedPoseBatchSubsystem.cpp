@@ -0,0 +1,163 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/TrackedPoseBatchSubsystem.h"
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TrackedPoseBatchSubsystem)
+
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "VRGlobalSettings.h"
+#include "GripMotionControllerComponent.h"
+#include "ReplicatedVRCameraComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("TrackedPoseBatch ApplyPoses"), STAT_TrackedPoseBatchApply, STATGROUP_Game);
+
+void FTrackedPoseBatchTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && IsValid(Target))
+	{
+		Target->ApplyPendingPoses();
+	}
+}
+
+FString FTrackedPoseBatchTickFunction::DiagnosticMessage()
+{
+	return TEXT("TrackedPoseBatchTickFunction");
+}
+
+FName FTrackedPoseBatchTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("TrackedPoseBatchTick"));
+}
+
+bool UTrackedPoseBatchSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Setting is resolved once per world here instead of on every incoming pose
+	return Super::ShouldCreateSubsystem(Outer) && GetDefault<UVRGlobalSettings>()->bBatchServerTrackedPoseUpdates;
+}
+
+void UTrackedPoseBatchSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	BatchTickFunction.TickGroup = TG_PrePhysics;
+	BatchTickFunction.EndTickGroup = TG_PrePhysics;
+	BatchTickFunction.bCanEverTick = true;
+	BatchTickFunction.bStartWithTickEnabled = true;
+	BatchTickFunction.bHighPriority = true;
+	BatchTickFunction.bTickEvenWhenPaused = false;
+	BatchTickFunction.Target = this;
+}
+
+void UTrackedPoseBatchSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.PersistentLevel && !BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+	}
+}
+
+void UTrackedPoseBatchSubsystem::Deinitialize()
+{
+	if (BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.UnRegisterTickFunction();
+	}
+
+	PendingComponents.Reset();
+	Super::Deinitialize();
+}
+
+UTrackedPoseBatchSubsystem* UTrackedPoseBatchSubsystem::GetActiveBatchSubsystem(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World || World->GetNetMode() >= ENetMode::NM_Client)
+	{
+		return nullptr;
+	}
+
+	// Only exists when batching is enabled
+	UTrackedPoseBatchSubsystem* BatchSubsystem = World->GetSubsystem<UTrackedPoseBatchSubsystem>();
+	return (BatchSubsystem && BatchSubsystem->BatchTickFunction.IsTickFunctionRegistered()) ? BatchSubsystem : nullptr;
+}
+
+void UTrackedPoseBatchSubsystem::QueuePendingPose(USceneComponent* TrackedComponent)
+{
+	bool bNewlyQueued = false;
+
+	if (UGripMotionControllerComponent* MotionController = Cast<UGripMotionControllerComponent>(TrackedComponent))
+	{
+		if (!MotionController->bHasPendingServerPose)
+		{
+			MotionController->bHasPendingServerPose = true;
+			bNewlyQueued = true;
+		}
+	}
+	else if (UReplicatedVRCameraComponent* Camera = Cast<UReplicatedVRCameraComponent>(TrackedComponent))
+	{
+		if (!Camera->bHasPendingServerPose)
+		{
+			Camera->bHasPendingServerPose = true;
+			bNewlyQueued = true;
+		}
+	}
+
+	if (!bNewlyQueued)
+	{
+		return;
+	}
+
+	PendingComponents.Add(TrackedComponent);
+
+	// Make sure that the component (grips), its owner and the owners movement see this frames pose
+	// Prerequisites are unique so re-adding them is cheap, RPCs are handled before the tick functions are queued for the frame
+	TrackedComponent->PrimaryComponentTick.AddPrerequisite(this, BatchTickFunction);
+	if (AActor* Owner = TrackedComponent->GetOwner())
+	{
+		Owner->PrimaryActorTick.AddPrerequisite(this, BatchTickFunction);
+
+		if (ACharacter* OwningCharacter = Cast<ACharacter>(Owner))
+		{
+			if (UCharacterMovementComponent* MoveComp = OwningCharacter->GetCharacterMovement())
+			{
+				MoveComp->PrimaryComponentTick.AddPrerequisite(this, BatchTickFunction);
+			}
+		}
+	}
+}
+
+void UTrackedPoseBatchSubsystem::ApplyPendingPoses()
+{
+	if (PendingComponents.Num() < 1)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_TrackedPoseBatchApply);
+
+	// Transform updates have to stay on the game thread, the win here is that each device
+	// only gets a single transform update per tick no matter how many poses arrived for it.
+	for (const TWeakObjectPtr<USceneComponent>& PendingComponent : PendingComponents)
+	{
+		if (!PendingComponent.IsValid())
+		{
+			continue;
+		}
+
+		if (UGripMotionControllerComponent* MotionController = Cast<UGripMotionControllerComponent>(PendingComponent.Get()))
+		{
+			MotionController->bHasPendingServerPose = false;
+			MotionController->OnRep_ReplicatedControllerTransform();
+		}
+		else if (UReplicatedVRCameraComponent* Camera = Cast<UReplicatedVRCameraComponent>(PendingComponent.Get()))
+		{
+			Camera->bHasPendingServerPose = false;
+			Camera->OnRep_ReplicatedCameraTransform();
+		}
+	}
+
+	PendingComponents.Reset();
+}
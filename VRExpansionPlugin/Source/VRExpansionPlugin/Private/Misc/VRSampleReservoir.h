@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Fixed size uniform sample of an unbounded stream (reservoir sampling) so that long soak and bench runs
+// can still report percentiles without the sample arrays growing forever.
+// Not thread safe, callers are expected to lock around it if they feed it from more than one thread.
+struct FVRSampleReservoir
+{
+public:
+
+	explicit FVRSampleReservoir(int32 InCapacity) :
+		Capacity(FMath::Max(InCapacity, 1)),
+		NumSeen(0),
+		RandomState(0x9E3779B97F4A7C15ull)
+	{}
+
+	void Reset()
+	{
+		Samples.Reset();
+		NumSeen = 0;
+	}
+
+	void Add(float Sample)
+	{
+		++NumSeen;
+		if (Samples.Num() < Capacity)
+		{
+			Samples.Add(Sample);
+			return;
+		}
+
+		// Keep each sample seen so far with equal probability Capacity / NumSeen
+		const uint64 Index = NextRandom() % NumSeen;
+		if (Index < (uint64)Capacity)
+		{
+			Samples[(int32)Index] = Sample;
+		}
+	}
+
+	// Total number of samples added since the last reset, the reservoir itself holds at most Capacity of them
+	uint64 GetNumSeen() const
+	{
+		return NumSeen;
+	}
+
+	// Moves the held samples out sorted ascending and resets the reservoir
+	TArray<float> ConsumeSorted()
+	{
+		TArray<float> Sorted = MoveTemp(Samples);
+		Sorted.Sort();
+		Reset();
+		return Sorted;
+	}
+
+	static float GetPercentile(const TArray<float>& SortedSamples, float Percentile)
+	{
+		if (SortedSamples.Num() == 0)
+		{
+			return 0.0f;
+		}
+
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * SortedSamples.Num()) - 1, 0, SortedSamples.Num() - 1);
+		return SortedSamples[Index];
+	}
+
+private:
+
+	// SplitMix64, the engine streams are float based and lose precision once NumSeen is in the millions
+	uint64 NextRandom()
+	{
+		uint64 Z = (RandomState += 0x9E3779B97F4A7C15ull);
+		Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+		return Z ^ (Z >> 31);
+	}
+
+	TArray<float> Samples;
+	int32 Capacity;
+	uint64 NumSeen;
+	uint64 RandomState;
+};
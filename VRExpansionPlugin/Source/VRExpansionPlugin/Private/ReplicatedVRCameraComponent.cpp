@@ -10,6 +10,7 @@
 #include "VRBaseCharacter.h"
 #include "VRCharacter.h"
 #include "VRRootComponent.h"
+#include "Misc/TrackedPoseBatchSubsystem.h"
 #include "IXRTrackingSystem.h"
 #include "IXRCamera.h"
 #include "Rendering/MotionVectorSimulation.h"
@@ -100,7 +101,15 @@ void UReplicatedVRCameraComponent::Server_SendCameraTransform_Implementation(FBP
 	// Don't call on rep on the server if the server controls this controller
 	if (!bHasAuthority)
 	{
-		OnRep_ReplicatedCameraTransform();
+		// Batched mode applies only the newest pose once per tick
+		if (UTrackedPoseBatchSubsystem* PoseBatchSubsystem = UTrackedPoseBatchSubsystem::GetActiveBatchSubsystem(this))
+		{
+			PoseBatchSubsystem->QueuePendingPose(this);
+		}
+		else
+		{
+			OnRep_ReplicatedCameraTransform();
+		}
 	}
 }
 
@@ -262,7 +271,24 @@ void UReplicatedVRCameraComponent::RunNetworkedSmoothing(float DeltaTime)
 
 	if (bLerpingPosition)
 	{
-		if (!bUseExponentialSmoothing)
+		if (bUseJitterBufferSmoothing)
+		{
+			// Buffered samples already have the roomscale offset applied
+			FVector BufferedPosition;
+			FQuat BufferedRotation;
+			bool bIsExtrapolating = false;
+			if (NetworkJitterBuffer.SamplePose(GetWorld()->GetRealTimeSeconds(), BufferedPosition, BufferedRotation, bIsExtrapolating))
+			{
+				SetRelativeLocationAndRotation(BufferedPosition, BufferedRotation);
+			}
+
+			// Reached the newest sample and ran out of extrapolation, hold here until the next update comes in
+			if (NetworkJitterBuffer.HasFinishedPlayback(GetWorld()->GetRealTimeSeconds()))
+			{
+				bLerpingPosition = false;
+			}
+		}
+		else if (!bUseExponentialSmoothing)
 		{
 			NetUpdateCount += DeltaTime;
 			float LerpVal = FMath::Clamp(NetUpdateCount / (1.0f / NetUpdateRate), 0.0f, 1.0f);
@@ -396,7 +422,21 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 			{
 				NetUpdateCount += DeltaTime;
 
-				if (NetUpdateCount >= (1.0f / NetUpdateRate))
+				float CurrentNetUpdateRate = NetUpdateRate;
+				if (AdaptiveNetUpdateSettings.bUseAdaptiveUpdateRate)
+				{
+					CurrentNetUpdateRate = AdaptiveNetUpdateSettings.GetAdaptiveUpdateRate(
+						NetUpdateRate,
+						RelativeLoc,
+						RelativeRot,
+						LastUpdatesRelativePosition,
+						LastUpdatesRelativeRotation,
+						NetUpdateCount,
+						FBPVRAdaptiveNetUpdateSettings::IsOwningConnectionSaturated(GetOwner())
+					);
+				}
+
+				if (CurrentNetUpdateRate > 0.0f && NetUpdateCount >= (1.0f / CurrentNetUpdateRate))
 				{
 					NetUpdateCount = 0.0f;
 
@@ -407,6 +447,12 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 						ReplicatedCameraTransform.Rotation = RelativeRot;
 					}
 
+					// Receivers buffer against our clock instead of their arrival times
+					if (bUseJitterBufferSmoothing)
+					{
+						ReplicatedCameraTransform.SetSenderTime(GetWorld()->GetRealTimeSeconds());
+					}
+
 #if WITH_PUSH_MODEL
 					MARK_PROPERTY_DIRTY_FROM_NAME(UReplicatedVRCameraComponent, ReplicatedCameraTransform, this);
 #endif
@@ -547,7 +593,23 @@ void UReplicatedVRCameraComponent::OnRep_ReplicatedCameraTransform()
 
 	}
     
-    if (bSmoothReplicatedMotion)
+	if (bSmoothReplicatedMotion && bUseJitterBufferSmoothing)
+	{
+		// Large jumps (teleports) clear out the buffer and snap instead of interpolating across them.
+		// Measured from the newest buffered sample, the played back pose trails it by the buffer delay.
+		FVector NewestPosition = GetRelativeLocation();
+		NetworkJitterBuffer.GetNewestPosition(NewestPosition);
+		if (!bReppedOnce || (CameraPosition - NewestPosition).SizeSquared() >= FMath::Square(NetworkNoSmoothUpdateDistance))
+		{
+			NetworkJitterBuffer.Reset();
+			SetRelativeLocationAndRotation(CameraPosition, ReplicatedCameraTransform.Rotation);
+			bReppedOnce = true;
+		}
+
+		NetworkJitterBuffer.AddSample(GetWorld()->GetRealTimeSeconds(), ReplicatedCameraTransform, CameraPosition);
+		bLerpingPosition = true;
+	}
+    else if (bSmoothReplicatedMotion)
     {
         if (bReppedOnce)
         {
@@ -588,6 +650,7 @@ void UReplicatedVRCameraComponent::OnRep_ReplicatedCameraTransform()
 void UReplicatedVRCameraComponent::SetNetUpdateRate(float NewNetUpdateRate)
 {
 	NetUpdateRate = NewNetUpdateRate;
+	++NonPoseReplicationVersion;
 #if WITH_PUSH_MODEL
 	MARK_PROPERTY_DIRTY_FROM_NAME(UReplicatedVRCameraComponent, NetUpdateRate, this);
 #endif
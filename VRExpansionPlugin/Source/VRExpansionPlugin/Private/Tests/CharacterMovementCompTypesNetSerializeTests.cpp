@@ -0,0 +1,295 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CharacterMovementCompTypes.h"
+#include "VRCharacterMovementComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/VRNetSerializationTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace VRNetSerializationTests;
+
+namespace CharacterMovementCompTypesNetTests
+{
+	static bool RoundTripInputVector(const FVector& Value, FVector& OutValue, int64* OutNumBits = nullptr)
+	{
+		FVector Sent = Value;
+		OutValue = FVector(-1.0);
+
+		return RoundTripBits(
+			[&](FArchive& Ar) { return FVRConditionalMoveRep::SerializeBoundedInputVector(Ar, Sent); },
+			[&](FArchive& Ar) { return FVRConditionalMoveRep::SerializeBoundedInputVector(Ar, OutValue); },
+			OutNumBits);
+	}
+
+	static bool RoundTripConditional(const FVRConditionalMoveRep& Sent, FVRConditionalMoveRep& Received, int64* OutNumBits = nullptr)
+	{
+		FVRConditionalMoveRep SentCopy = Sent;
+
+		return RoundTripBits(
+			[&](FArchive& Ar) { bool bSuccess = true; return SentCopy.NetSerialize(Ar, nullptr, bSuccess) && bSuccess; },
+			[&](FArchive& Ar) { bool bSuccess = true; return Received.NetSerialize(Ar, nullptr, bSuccess) && bSuccess; },
+			OutNumBits);
+	}
+
+	static FVector Quantize100(const FVector& Value)
+	{
+		return FVector(FMath::RoundToInt(Value.X * 100.0), FMath::RoundToInt(Value.Y * 100.0), FMath::RoundToInt(Value.Z * 100.0)) / 100.0;
+	}
+
+	static FVRMoveActionContainer MakeTeleportAction()
+	{
+		FVRMoveActionContainer MoveAction;
+		MoveAction.MoveAction = EVRMoveAction::VRMOVEACTION_Teleport;
+		MoveAction.MoveActionLoc = FVector(1024.5, -300.25, 88.0);
+		MoveAction.MoveActionRot = FRotator(0.0f, 90.0f, 0.0f);
+		MoveAction.MoveActionFlags = 0x01;
+		return MoveAction;
+	}
+
+	static bool RoundTripCompactCorrection(const FVRCharacterMoveResponseDataContainer& Sent, FVRCharacterMoveResponseDataContainer& Received, const FVector& Reference, int64* OutNumBits = nullptr)
+	{
+		FVRCharacterMoveResponseDataContainer SentCopy = Sent;
+
+		return RoundTripBits(
+			[&](FArchive& Ar) { return SentCopy.SerializeCompactCorrection(Ar, Reference); },
+			[&](FArchive& Ar) { return Received.SerializeCompactCorrection(Ar, Reference); },
+			OutNumBits);
+	}
+
+	static bool RoundTripResponse(UCharacterMovementComponent& MoveComp, const FVRCharacterMoveResponseDataContainer& Sent, FVRCharacterMoveResponseDataContainer& Received, int64* OutNumBits = nullptr)
+	{
+		FVRCharacterMoveResponseDataContainer SentCopy = Sent;
+
+		return RoundTripBits(
+			[&](FArchive& Ar) { return SentCopy.Serialize(MoveComp, Ar, nullptr); },
+			[&](FArchive& Ar) { return Received.Serialize(MoveComp, Ar, nullptr); },
+			OutNumBits);
+	}
+
+	// Walking correction a few units off of what the client reported, no base
+	static FVRCharacterMoveResponseDataContainer MakeCorrection(const FVector& ClientReportedLocation)
+	{
+		FVRCharacterMoveResponseDataContainer Response;
+		Response.bIsGoodMove = false;
+		Response.bHasBase = false;
+		Response.bHasRotation = true;
+		Response.bRootMotionMontageCorrection = false;
+		Response.bRootMotionSourceCorrection = false;
+		Response.ClientAdjustment.TimeStamp = 48.1234f;
+		Response.ClientAdjustment.NewLoc = ClientReportedLocation + FVector(3.21, -0.5, 0.07);
+		Response.ClientAdjustment.NewVel = FVector(350.25, -20.0, 0.0);
+		Response.ClientAdjustment.NewRot = FRotator(0.0f, 90.0f, 0.0f);
+		Response.ClientAdjustment.GravityDirection = UCharacterMovementComponent::DefaultGravityDirection;
+		Response.ClientAdjustment.MovementMode = MOVE_Walking;
+		Response.ClientAdjustment.bBaseRelativePosition = false;
+		Response.ClientAdjustment.bBaseRelativeVelocity = false;
+		return Response;
+	}
+
+	static void TestCorrectionEqual(FAutomationTestBase& Test, const TCHAR* What, const FVRCharacterMoveResponseDataContainer& Received, const FVRCharacterMoveResponseDataContainer& Sent)
+	{
+		const FClientAdjustment& In = Received.ClientAdjustment;
+		const FClientAdjustment& Out = Sent.ClientAdjustment;
+		Test.TestTrue(FString::Printf(TEXT("%s is a correction"), What), Received.IsCorrection());
+		Test.TestTrue(FString::Printf(TEXT("%s location"), What), In.NewLoc.Equals(Quantize100(Out.NewLoc), UE_DOUBLE_KINDA_SMALL_NUMBER));
+		Test.TestTrue(FString::Printf(TEXT("%s velocity"), What), MaxAxisError(In.NewVel, Out.NewVel) <= 0.051);
+		Test.TestTrue(FString::Printf(TEXT("%s gravity"), What), In.GravityDirection.Equals(Out.GravityDirection, 0.001));
+		Test.TestEqual(FString::Printf(TEXT("%s movement mode"), What), In.MovementMode, Out.MovementMode);
+		Test.TestEqual(FString::Printf(TEXT("%s base relative position"), What), (bool)In.bBaseRelativePosition, (bool)Out.bBaseRelativePosition);
+		Test.TestEqual(FString::Printf(TEXT("%s base relative velocity"), What), (bool)In.bBaseRelativeVelocity, (bool)Out.bBaseRelativeVelocity);
+		Test.TestEqual(FString::Printf(TEXT("%s has rotation"), What), Received.bHasRotation, Sent.bHasRotation);
+
+		if (Sent.bHasRotation)
+		{
+			Test.TestTrue(FString::Printf(TEXT("%s rotation"), What), FMath::IsNearlyEqual(In.NewRot.Yaw, Out.NewRot.Yaw, 0.01f));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBoundedInputVectorTest, "VRExpansionPlugin.NetSerialization.ConditionalMoveRep.BoundedInputVector", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRBoundedInputVectorTest::RunTest(const FString& Parameters)
+{
+	using namespace CharacterMovementCompTypesNetTests;
+
+	FVector Received;
+	int64 ZeroBits = 0;
+	int64 PlanarBits = 0;
+	int64 FullBits = 0;
+	int64 FallbackBits = 0;
+
+	// Exact zero is the mode, width and two sign bits
+	TestTrue(TEXT("Zero round trip"), RoundTripInputVector(FVector::ZeroVector, Received, &ZeroBits));
+	TestTrue(TEXT("Zero exact"), Received == FVector::ZeroVector);
+	TestEqual(TEXT("Zero bits"), ZeroBits, (int64)8);
+
+	const FVector Planar(1.23, -4.56, 0.001);
+	TestTrue(TEXT("Planar round trip"), RoundTripInputVector(Planar, Received, &PlanarBits));
+	TestTrue(TEXT("Planar decodes to the quantized value"), Received.Equals(Quantize100(Planar), UE_DOUBLE_KINDA_SMALL_NUMBER));
+	TestTrue(TEXT("Planar has no Z"), Received.Z == 0.0);
+
+	const FVector Full(1.23, -4.56, 0.78);
+	TestTrue(TEXT("3D round trip"), RoundTripInputVector(Full, Received, &FullBits));
+	TestTrue(TEXT("3D decodes to the quantized value"), Received.Equals(Quantize100(Full), UE_DOUBLE_KINDA_SMALL_NUMBER));
+	TestTrue(TEXT("Planar is smaller than 3D"), PlanarBits < FullBits);
+
+	// Edges of the bounded range on every axis
+	const FVector Edge(327.67, -327.67, 327.67);
+	TestTrue(TEXT("Edge round trip"), RoundTripInputVector(Edge, Received));
+	TestTrue(TEXT("Edge decodes to the quantized value"), Received.Equals(Quantize100(Edge), UE_DOUBLE_KINDA_SMALL_NUMBER));
+
+	// Past the range on a single axis falls back to the packed vector
+	const FVector OutOfRange(0.5, 400.0, -2.25);
+	TestTrue(TEXT("Fallback round trip"), RoundTripInputVector(OutOfRange, Received, &FallbackBits));
+	TestTrue(TEXT("Fallback error"), MaxAxisError(Received, OutOfRange) <= 0.01);
+	TestTrue(TEXT("Bounded is smaller than the fallback"), FullBits < FallbackBits);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRConditionalMoveRepMaskTest, "VRExpansionPlugin.NetSerialization.ConditionalMoveRep.PresenceMasks", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRConditionalMoveRepMaskTest::RunTest(const FString& Parameters)
+{
+	using namespace CharacterMovementCompTypesNetTests;
+
+	const FVector InputVector(12.34, -5.67, 0.0);
+	const FVector RequestedVelocity(250.5, 0.0, -980.25);
+	const int32 NumMasks = 1 << 3;
+
+	for (int32 Mask = 0; Mask < NumMasks; ++Mask)
+	{
+		const bool bHasInput = (Mask & FVRConditionalMoveRep::Presence_VRInput) != 0;
+		const bool bHasVelocity = (Mask & FVRConditionalMoveRep::Presence_RequestedVelocity) != 0;
+		const bool bHasActions = (Mask & FVRConditionalMoveRep::Presence_MoveActions) != 0;
+
+		FVRConditionalMoveRep Sent;
+		Sent.CustomVRInputVector = bHasInput ? InputVector : FVector::ZeroVector;
+		Sent.RequestedVelocity = bHasVelocity ? RequestedVelocity : FVector::ZeroVector;
+		if (bHasActions)
+		{
+			Sent.MoveActionArray.MoveActions.Add(MakeTeleportAction());
+			FVRMoveActionContainer& StopAction = Sent.MoveActionArray.MoveActions.AddDefaulted_GetRef();
+			StopAction.MoveAction = EVRMoveAction::VRMOVEACTION_StopAllMovement;
+		}
+
+		// The receiver is reused across moves, anything not present has to be cleared
+		FVRConditionalMoveRep Received;
+		Received.CustomVRInputVector = FVector(99.0);
+		Received.RequestedVelocity = FVector(-99.0);
+		Received.MoveActionArray.MoveActions.Add(MakeTeleportAction());
+
+		int64 NumBits = 0;
+		TestTrue(FString::Printf(TEXT("Mask %d round trip"), Mask), RoundTripConditional(Sent, Received, &NumBits));
+
+		if (Mask == 0)
+		{
+			TestEqual(TEXT("Empty move is a single bit"), NumBits, (int64)1);
+		}
+
+		TestTrue(FString::Printf(TEXT("Mask %d input vector"), Mask), Received.CustomVRInputVector.Equals(Quantize100(Sent.CustomVRInputVector), UE_DOUBLE_KINDA_SMALL_NUMBER));
+		TestTrue(FString::Printf(TEXT("Mask %d requested velocity"), Mask), MaxAxisError(Received.RequestedVelocity, Sent.RequestedVelocity) <= 0.01);
+		TestEqual(FString::Printf(TEXT("Mask %d move action count"), Mask), Received.MoveActionArray.MoveActions.Num(), Sent.MoveActionArray.MoveActions.Num());
+
+		if (bHasActions && Received.MoveActionArray.MoveActions.Num() == 2)
+		{
+			const FVRMoveActionContainer& Teleport = Received.MoveActionArray.MoveActions[0];
+			TestTrue(FString::Printf(TEXT("Mask %d teleport action"), Mask), Teleport.MoveAction == EVRMoveAction::VRMOVEACTION_Teleport);
+			TestTrue(FString::Printf(TEXT("Mask %d teleport location"), Mask), MaxAxisError(Teleport.MoveActionLoc, MakeTeleportAction().MoveActionLoc) <= 0.01);
+			TestTrue(FString::Printf(TEXT("Mask %d teleport yaw"), Mask), FMath::IsNearlyEqual(Teleport.MoveActionRot.Yaw, 90.0f, 0.01f));
+			TestEqual(FString::Printf(TEXT("Mask %d teleport flags"), Mask), Teleport.MoveActionFlags, (uint8)0x01);
+			TestTrue(FString::Printf(TEXT("Mask %d stop action"), Mask), Received.MoveActionArray.MoveActions[1].MoveAction == EVRMoveAction::VRMOVEACTION_StopAllMovement);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRMoveResponseCompactCorrectionTest, "VRExpansionPlugin.NetSerialization.MoveResponse.CompactCorrection", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRMoveResponseCompactCorrectionTest::RunTest(const FString& Parameters)
+{
+	using namespace CharacterMovementCompTypesNetTests;
+
+	const FVector Reference(-1520.37, 8800.5, 92.15);
+	const FVRCharacterMoveResponseDataContainer Sent = MakeCorrection(Reference);
+
+	FVRCharacterMoveResponseDataContainer Received;
+	Received.bIsGoodMove = true;
+	Received.bRootMotionSourceCorrection = true;
+	int64 CompactBits = 0;
+
+	TestTrue(TEXT("Round trip"), RoundTripCompactCorrection(Sent, Received, Reference, &CompactBits));
+	TestCorrectionEqual(*this, TEXT("Compact"), Received, Sent);
+	TestFalse(TEXT("Root motion source flag cleared"), Received.bRootMotionSourceCorrection);
+	TestFalse(TEXT("Not an ack"), (bool)Received.ClientAdjustment.bAckGoodMove);
+
+	// Base relative flags, no rotation and a custom gravity direction
+	FVRCharacterMoveResponseDataContainer Relative = MakeCorrection(Reference);
+	Relative.bHasRotation = false;
+	Relative.ClientAdjustment.bBaseRelativePosition = true;
+	Relative.ClientAdjustment.bBaseRelativeVelocity = true;
+	Relative.ClientAdjustment.GravityDirection = FVector(0.0, 1.0, 0.0);
+	Relative.ClientAdjustment.MovementMode = MOVE_Falling;
+
+	TestTrue(TEXT("Relative round trip"), RoundTripCompactCorrection(Relative, Received, Reference));
+	TestCorrectionEqual(*this, TEXT("Relative"), Received, Relative);
+	TestTrue(TEXT("Relative rotation cleared"), Received.ClientAdjustment.NewRot.IsZero());
+
+	// A reference in a different space is only a larger residual, the location still decodes exactly
+	FVRCharacterMoveResponseDataContainer FarSent = MakeCorrection(Reference);
+	FarSent.ClientAdjustment.NewLoc = FVector(25.5, -3.0, 10.0);
+	TestTrue(TEXT("Far reference round trip"), RoundTripCompactCorrection(FarSent, Received, Reference));
+	TestTrue(TEXT("Far reference location"), Received.ClientAdjustment.NewLoc.Equals(Quantize100(FarSent.ClientAdjustment.NewLoc), UE_DOUBLE_KINDA_SMALL_NUMBER));
+
+	// Has to beat the engine encoding of the same correction
+	UVRCharacterMovementComponent* MoveComp = NewObject<UVRCharacterMovementComponent>(GetTransientPackage());
+	MoveComp->bCompactClientCorrections = false;
+	int64 FullBits = 0;
+	TestTrue(TEXT("Full round trip"), RoundTripResponse(*MoveComp, Sent, Received, &FullBits));
+	TestCorrectionEqual(*this, TEXT("Full"), Received, Sent);
+	TestTrue(TEXT("Compact is smaller than the full encoding"), CompactBits < FullBits);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRMoveResponseFallbackTest, "VRExpansionPlugin.NetSerialization.MoveResponse.Fallback", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRMoveResponseFallbackTest::RunTest(const FString& Parameters)
+{
+	using namespace CharacterMovementCompTypesNetTests;
+
+	UVRCharacterMovementComponent* MoveComp = NewObject<UVRCharacterMovementComponent>(GetTransientPackage());
+	MoveComp->bCompactClientCorrections = true;
+
+	const FVector Reference(100.0, 200.0, 90.0);
+	const FVRCharacterMoveResponseDataContainer Sent = MakeCorrection(Reference);
+	FVRCharacterMoveResponseDataContainer Received;
+
+	// No reference stored for the corrected move, has to go out in full
+	MoveComp->SetClientCorrectionReference(-1.f, FVector::ZeroVector);
+	TestTrue(TEXT("No reference round trip"), RoundTripResponse(*MoveComp, Sent, Received));
+	TestCorrectionEqual(*this, TEXT("No reference"), Received, Sent);
+
+	// Reference for a different move
+	MoveComp->SetClientCorrectionReference(Sent.ClientAdjustment.TimeStamp - 0.011f, Reference);
+	TestTrue(TEXT("Other move round trip"), RoundTripResponse(*MoveComp, Sent, Received));
+	TestCorrectionEqual(*this, TEXT("Other move"), Received, Sent);
+
+	// Acks never go compact
+	FVRCharacterMoveResponseDataContainer Ack;
+	Ack.bIsGoodMove = true;
+	Ack.ClientAdjustment.TimeStamp = 12.5f;
+	Ack.ClientAdjustment.bAckGoodMove = true;
+	MoveComp->SetClientCorrectionReference(Ack.ClientAdjustment.TimeStamp, Reference);
+	TestTrue(TEXT("Ack round trip"), RoundTripResponse(*MoveComp, Ack, Received));
+	TestTrue(TEXT("Ack is a good move"), Received.IsGoodMove());
+	TestEqual(TEXT("Ack time stamp"), Received.ClientAdjustment.TimeStamp, 12.5f);
+
+	// A client that no longer holds the corrected move reads past it without failing, the adjustment drops it later
+	MoveComp->SetClientCorrectionReference(Sent.ClientAdjustment.TimeStamp, Reference);
+	TestTrue(TEXT("Unknown move round trip"), RoundTripResponse(*MoveComp, Sent, Received));
+	TestEqual(TEXT("Unknown move time stamp"), Received.ClientAdjustment.TimeStamp, Sent.ClientAdjustment.TimeStamp);
+	TestEqual(TEXT("Unknown move mode"), Received.ClientAdjustment.MovementMode, Sent.ClientAdjustment.MovementMode);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
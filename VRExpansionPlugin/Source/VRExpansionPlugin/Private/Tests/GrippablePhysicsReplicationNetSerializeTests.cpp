@@ -0,0 +1,162 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grippables/GrippablePhysicsReplication.h"
+#include "VRGlobalSettings.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/VRNetSerializationTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace VRNetSerializationTests;
+
+namespace GrippablePhysicsReplicationNetTests
+{
+	static bool RoundTripCompact(const FVRRepMovementCompactSettings& Settings, const FRepMovementVR& Sent, FRepMovementVR& Received, int64* OutNumBits = nullptr)
+	{
+		FRepMovementVR SentCopy = Sent;
+
+		return RoundTripBits(
+			[&](FArchive& Ar) { bool bSuccess = true; return SentCopy.NetSerializeCompact(Ar, nullptr, bSuccess, Settings) && bSuccess; },
+			[&](FArchive& Ar) { bool bSuccess = true; return Received.NetSerializeCompact(Ar, nullptr, bSuccess, Settings) && bSuccess; },
+			OutNumBits);
+	}
+
+	// Worst case error of the bounded quantization, half a step plus float slack
+	static double BoundedTolerance(float MaxValue, int32 NumBits)
+	{
+		return (MaxValue / (double)((1u << NumBits) - 2)) + 0.001;
+	}
+
+	static FRepMovementVR MakeMovement(const FVector& Location, const FRotator& Rotation, const FVector& LinearVelocity, const FVector& AngularVelocity)
+	{
+		FRepMovementVR Movement;
+		Movement.Location = Location;
+		Movement.Rotation = Rotation;
+		Movement.LinearVelocity = LinearVelocity;
+		Movement.AngularVelocity = AngularVelocity;
+		Movement.bRepPhysics = true;
+		Movement.bSimulatedPhysicSleep = false;
+		Movement.ServerFrame = 123456;
+		return Movement;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRRepMovementCompactInRangeTest, "VRExpansionPlugin.NetSerialization.RepMovementCompact.InRange", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRRepMovementCompactInRangeTest::RunTest(const FString& Parameters)
+{
+	using namespace GrippablePhysicsReplicationNetTests;
+
+	FVRRepMovementCompactSettings Settings;
+	Settings.bUseCompactSerialization = true;
+
+	const FRepMovementVR Sent = MakeMovement(FVector(1234.56, -78.9, 250.01), FRotator(30.0f, -120.5f, 75.25f), FVector(-1200.5, 45.25, 2499.0), FVector(900.0, -1799.0, 12.5));
+	FRepMovementVR Received;
+	int64 CompactBits = 0;
+
+	TestTrue(TEXT("Round trip"), RoundTripCompact(Settings, Sent, Received, &CompactBits));
+	TestTrue(TEXT("Location error"), MaxAxisError(Received.Location, Sent.Location) <= 0.01);
+	TestTrue(TEXT("Rotation error"), AngleBetweenDegrees(Received.Rotation.Quaternion(), Sent.Rotation.Quaternion()) <= 0.2);
+	TestTrue(TEXT("Linear velocity error"), MaxAxisError(Received.LinearVelocity, Sent.LinearVelocity) <= BoundedTolerance(Settings.MaxLinearVelocity, Settings.LinearVelocityBits));
+	TestTrue(TEXT("Angular velocity error"), MaxAxisError(Received.AngularVelocity, Sent.AngularVelocity) <= BoundedTolerance(Settings.MaxAngularVelocity, Settings.AngularVelocityBits));
+	TestEqual(TEXT("RepPhysics"), (bool)Received.bRepPhysics, (bool)Sent.bRepPhysics);
+	TestEqual(TEXT("Sleep flag"), (bool)Received.bSimulatedPhysicSleep, (bool)Sent.bSimulatedPhysicSleep);
+	TestEqual(TEXT("Server frame"), Received.ServerFrame, Sent.ServerFrame);
+
+	// Compact should beat the engine serialization at the same quantization levels
+	FRepMovementVR EngineSent = Sent;
+	FRepMovementVR EngineReceived;
+	int64 EngineBits = 0;
+	RoundTripBits(
+		[&](FArchive& Ar) { bool bSuccess = true; return EngineSent.FRepMovement::NetSerialize(Ar, nullptr, bSuccess) && bSuccess; },
+		[&](FArchive& Ar) { bool bSuccess = true; return EngineReceived.FRepMovement::NetSerialize(Ar, nullptr, bSuccess) && bSuccess; },
+		&EngineBits);
+	TestTrue(TEXT("Compact is smaller than the engine serialization"), CompactBits < EngineBits);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRRepMovementCompactOutOfRangeTest, "VRExpansionPlugin.NetSerialization.RepMovementCompact.OutOfRangeFallback", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRRepMovementCompactOutOfRangeTest::RunTest(const FString& Parameters)
+{
+	using namespace GrippablePhysicsReplicationNetTests;
+
+	FVRRepMovementCompactSettings Settings;
+	Settings.bUseCompactSerialization = true;
+
+	// One axis past the bound on each velocity sends that whole vector packed at one decimal
+	const FRepMovementVR Sent = MakeMovement(FVector(-50000.0, 0.0, 10.0), FRotator(-89.0f, 179.0f, -179.0f), FVector(5000.25, -10.0, 3.0), FVector(0.0, 4000.5, -2000.0));
+	FRepMovementVR Received;
+
+	TestTrue(TEXT("Round trip"), RoundTripCompact(Settings, Sent, Received));
+	TestTrue(TEXT("Location error"), MaxAxisError(Received.Location, Sent.Location) <= 0.01);
+	TestTrue(TEXT("Rotation error"), AngleBetweenDegrees(Received.Rotation.Quaternion(), Sent.Rotation.Quaternion()) <= 0.2);
+	TestTrue(TEXT("Linear velocity fallback error"), MaxAxisError(Received.LinearVelocity, Sent.LinearVelocity) <= 0.051);
+	TestTrue(TEXT("Angular velocity fallback error"), MaxAxisError(Received.AngularVelocity, Sent.AngularVelocity) <= 0.051);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRRepMovementCompactZeroTest, "VRExpansionPlugin.NetSerialization.RepMovementCompact.ExactZero", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRRepMovementCompactZeroTest::RunTest(const FString& Parameters)
+{
+	using namespace GrippablePhysicsReplicationNetTests;
+
+	FVRRepMovementCompactSettings Settings;
+	Settings.bUseCompactSerialization = true;
+	Settings.bOmitSmallAngularVelocity = false;
+
+	// Resting bodies have to decode to exactly zero or they never settle on the receiving side
+	const int32 BitCounts[] = { 4, 11, 16, 24 };
+	for (int32 NumBits : BitCounts)
+	{
+		Settings.LinearVelocityBits = NumBits;
+		Settings.AngularVelocityBits = NumBits;
+
+		FRepMovementVR Sent = MakeMovement(FVector(10.0, 20.0, 30.0), FRotator::ZeroRotator, FVector::ZeroVector, FVector::ZeroVector);
+		Sent.bSimulatedPhysicSleep = true;
+		FRepMovementVR Received = MakeMovement(FVector::ZeroVector, FRotator::ZeroRotator, FVector(1.0), FVector(1.0));
+
+		TestTrue(FString::Printf(TEXT("Round trip %d bits"), NumBits), RoundTripCompact(Settings, Sent, Received));
+		TestTrue(FString::Printf(TEXT("Zero linear velocity %d bits"), NumBits), Received.LinearVelocity == FVector::ZeroVector);
+		TestTrue(FString::Printf(TEXT("Zero angular velocity %d bits"), NumBits), Received.AngularVelocity == FVector::ZeroVector);
+		TestTrue(FString::Printf(TEXT("Sleep flag %d bits"), NumBits), (bool)Received.bSimulatedPhysicSleep);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRRepMovementCompactOmittedAngularTest, "VRExpansionPlugin.NetSerialization.RepMovementCompact.OmittedAngularVelocity", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRRepMovementCompactOmittedAngularTest::RunTest(const FString& Parameters)
+{
+	using namespace GrippablePhysicsReplicationNetTests;
+
+	FVRRepMovementCompactSettings Settings;
+	Settings.bUseCompactSerialization = true;
+	Settings.bOmitSmallAngularVelocity = true;
+	Settings.AngularVelocityOmitThreshold = 1.0f;
+
+	const FRepMovementVR Slow = MakeMovement(FVector(5.0, 5.0, 5.0), FRotator(10.0f, 20.0f, 30.0f), FVector(100.0, 0.0, -50.0), FVector(0.5, -0.75, 0.25));
+	FRepMovementVR Received = MakeMovement(FVector::ZeroVector, FRotator::ZeroRotator, FVector::ZeroVector, FVector(99.0));
+	int64 OmittedBits = 0;
+
+	TestTrue(TEXT("Omitted round trip"), RoundTripCompact(Settings, Slow, Received, &OmittedBits));
+	TestTrue(TEXT("Omitted angular velocity decodes to zero"), Received.AngularVelocity == FVector::ZeroVector);
+	TestTrue(TEXT("Linear velocity still sent"), MaxAxisError(Received.LinearVelocity, Slow.LinearVelocity) <= BoundedTolerance(Settings.MaxLinearVelocity, Settings.LinearVelocityBits));
+
+	// Same movement with omission off keeps the angular velocity and costs the extra bits
+	Settings.bOmitSmallAngularVelocity = false;
+	int64 IncludedBits = 0;
+	TestTrue(TEXT("Included round trip"), RoundTripCompact(Settings, Slow, Received, &IncludedBits));
+	TestTrue(TEXT("Included angular velocity error"), MaxAxisError(Received.AngularVelocity, Slow.AngularVelocity) <= BoundedTolerance(Settings.MaxAngularVelocity, Settings.AngularVelocityBits));
+	TestTrue(TEXT("Omitting saves bits"), OmittedBits < IncludedBits);
+
+	// Above the threshold it is always sent
+	Settings.bOmitSmallAngularVelocity = true;
+	const FRepMovementVR Spinning = MakeMovement(FVector(5.0, 5.0, 5.0), FRotator(10.0f, 20.0f, 30.0f), FVector::ZeroVector, FVector(0.0, 0.0, 1.5));
+	TestTrue(TEXT("Spinning round trip"), RoundTripCompact(Settings, Spinning, Received));
+	TestTrue(TEXT("Spinning angular velocity kept"), MaxAxisError(Received.AngularVelocity, Spinning.AngularVelocity) <= BoundedTolerance(Settings.MaxAngularVelocity, Settings.AngularVelocityBits));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VRBPDatatypes.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "Tests/VRNetSerializationTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace VRNetSerializationTests;
+
+namespace VRBPDatatypesNetTests
+{
+	static bool RoundTripTransformProfile(EVRTransformQuantizationProfile Profile, const FTransform& InTransform, FTransform& OutTransform, int64* OutNumBits = nullptr)
+	{
+		FTransform_NetQuantize Sent(InTransform);
+		FTransform_NetQuantize Received;
+
+		return RoundTripBits(
+			[&](FArchive& Ar) { bool bSuccess = true; Sent.NetSerializeWithProfile(Profile, Ar, nullptr, bSuccess); return bSuccess; },
+			[&](FArchive& Ar) { bool bSuccess = true; Received.NetSerializeWithProfile(Profile, Ar, nullptr, bSuccess); OutTransform = Received; return bSuccess; },
+			OutNumBits);
+	}
+
+	static bool IsHighPrecisionOverrideOn()
+	{
+		const IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("vrexp.RepHighPrecisionTransforms"));
+		return CVar && CVar->GetInt() > 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRTransformProfileHandLocalTest, "VRExpansionPlugin.NetSerialization.TransformProfiles.HandLocal", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRTransformProfileHandLocalTest::RunTest(const FString& Parameters)
+{
+	using namespace VRBPDatatypesNetTests;
+
+	const FQuat TestRotation = FRotator(12.5f, -170.25f, 89.9f).Quaternion();
+	FTransform Received;
+
+	// In range, fixed point translation and 15 bit rotation
+	{
+		const FTransform InRange(TestRotation, FVector(12.345, -67.891, 199.5));
+		int64 HandLocalBits = 0;
+		TestTrue(TEXT("In range round trip"), RoundTripTransformProfile(EVRTransformQuantizationProfile::HandLocal, InRange, Received, &HandLocalBits));
+		TestTrue(TEXT("In range translation error"), MaxAxisError(Received.GetTranslation(), InRange.GetTranslation()) <= 0.01);
+		TestTrue(TEXT("In range rotation error"), AngleBetweenDegrees(Received.GetRotation(), InRange.GetRotation()) <= 0.02);
+		TestTrue(TEXT("In range unit scale"), Received.GetScale3D().Equals(FVector::OneVector, 0.0));
+
+		if (!IsHighPrecisionOverrideOn())
+		{
+			int64 DefaultBits = 0;
+			FTransform DefaultReceived;
+			TestTrue(TEXT("Default round trip"), RoundTripTransformProfile(EVRTransformQuantizationProfile::Default, InRange, DefaultReceived, &DefaultBits));
+			TestTrue(TEXT("HandLocal is smaller than Default"), HandLocalBits < DefaultBits);
+		}
+	}
+
+	// Out of range falls back to the packed translation
+	{
+		const FTransform OutOfRange(TestRotation, FVector(500.25, -0.5, -300.75));
+		TestTrue(TEXT("Out of range round trip"), RoundTripTransformProfile(EVRTransformQuantizationProfile::HandLocal, OutOfRange, Received));
+		TestTrue(TEXT("Out of range translation error"), MaxAxisError(Received.GetTranslation(), OutOfRange.GetTranslation()) <= 0.01);
+		TestTrue(TEXT("Out of range rotation error"), AngleBetweenDegrees(Received.GetRotation(), OutOfRange.GetRotation()) <= 0.02);
+	}
+
+	// Non unit scale is sent explicitly
+	{
+		const FTransform Scaled(TestRotation, FVector(1.0, 2.0, 3.0), FVector(1.5, 0.25, 2.0));
+		TestTrue(TEXT("Scaled round trip"), RoundTripTransformProfile(EVRTransformQuantizationProfile::HandLocal, Scaled, Received));
+		TestTrue(TEXT("Scale error"), MaxAxisError(Received.GetScale3D(), Scaled.GetScale3D()) <= 0.01);
+	}
+
+	// Identity and exact zero stay exact enough to compare equal
+	{
+		TestTrue(TEXT("Identity round trip"), RoundTripTransformProfile(EVRTransformQuantizationProfile::HandLocal, FTransform::Identity, Received));
+		TestTrue(TEXT("Identity translation"), MaxAxisError(Received.GetTranslation(), FVector::ZeroVector) <= 0.01);
+		TestTrue(TEXT("Identity rotation"), AngleBetweenDegrees(Received.GetRotation(), FQuat::Identity) <= 0.02);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRTransformProfileWorldSpaceTest, "VRExpansionPlugin.NetSerialization.TransformProfiles.WorldSpace", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRTransformProfileWorldSpaceTest::RunTest(const FString& Parameters)
+{
+	using namespace VRBPDatatypesNetTests;
+
+	FTransform Received;
+
+	const FVector TestLocations[] = { FVector(123456.7, -5000.2, 300.0), FVector(-0.04, 0.06, 0.0), FVector(800000.0, 0.0, -800000.0) };
+	const FRotator TestRotations[] = { FRotator(0.0f, 0.0f, 0.0f), FRotator(-45.0f, 179.9f, 10.0f), FRotator(89.0f, -90.0f, -179.0f) };
+
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(TestLocations); ++Index)
+	{
+		const FTransform Sent(TestRotations[Index].Quaternion(), TestLocations[Index]);
+		TestTrue(FString::Printf(TEXT("Round trip %d"), Index), RoundTripTransformProfile(EVRTransformQuantizationProfile::WorldSpace, Sent, Received));
+		TestTrue(FString::Printf(TEXT("Translation error %d"), Index), MaxAxisError(Received.GetTranslation(), Sent.GetTranslation()) <= 0.051);
+		TestTrue(FString::Printf(TEXT("Rotation error %d"), Index), AngleBetweenDegrees(Received.GetRotation(), Sent.GetRotation()) <= 0.1);
+		TestTrue(FString::Printf(TEXT("Unit scale %d"), Index), Received.GetScale3D().Equals(FVector::OneVector, 0.0));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
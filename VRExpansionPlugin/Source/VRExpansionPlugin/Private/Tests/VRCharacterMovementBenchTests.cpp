@@ -0,0 +1,291 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VRCharacter.h"
+#include "VRAIController.h"
+#include "VRRootComponent.h"
+#include "ReplicatedVRCameraComponent.h"
+#include "GripMotionControllerComponent.h"
+#include "VRCharacterMovementBench.h"
+#include "Misc/VRSampleReservoir.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRCharacterMovementBenchTests
+{
+	static const float FrameDeltaTime = 1.0f / 90.0f;
+	static const float BenchDuration = 10.0f;
+
+	// One frame of what a headset client would be sending
+	struct FTrackSample
+	{
+		float SendTime = 0.0f;
+		FTransform Head;
+		FTransform LeftHand;
+		FTransform RightHand;
+		FVector MoveInput = FVector::ZeroVector;
+	};
+
+	struct FSyntheticClient
+	{
+		TWeakObjectPtr<AVRCharacter> Character;
+		TArray<FTrackSample> InFlight;
+		FVector LastMoveInput = FVector::ZeroVector;
+		float Phase = 0.0f;
+	};
+
+	// Standing roomscale play, looking around, swinging the hands and walking in on and off bursts
+	static FTrackSample MakeTrackSample(float Time, float Phase)
+	{
+		FTrackSample Sample;
+		Sample.SendTime = Time;
+
+		const float Angle = 0.8f * Time + Phase;
+		const FVector HeadLocation(40.0f * FMath::Cos(Angle), 40.0f * FMath::Sin(Angle), 165.0f + 4.0f * FMath::Sin(3.0f * Angle));
+		const FRotator HeadRotation(10.0f * FMath::Sin(1.3f * Time + Phase), 60.0f * FMath::Sin(0.5f * Time + Phase), 0.0f);
+		Sample.Head = FTransform(HeadRotation, HeadLocation);
+
+		const FRotator HeadYaw(0.0f, HeadRotation.Yaw, 0.0f);
+		const float Swing = 15.0f * FMath::Sin(4.0f * Time + Phase);
+		Sample.LeftHand = FTransform(HeadYaw, HeadLocation + HeadYaw.RotateVector(FVector(30.0f + Swing, -25.0f, -35.0f)));
+		Sample.RightHand = FTransform(HeadYaw, HeadLocation + HeadYaw.RotateVector(FVector(30.0f - Swing, 25.0f, -35.0f)));
+
+		if (FMath::Sin(0.25f * Time + Phase) > 0.0f)
+		{
+			Sample.MoveInput = FRotator(0.0f, FMath::RadiansToDegrees(0.3f * Time + Phase), 0.0f).Vector() * 0.6f;
+		}
+
+		return Sample;
+	}
+
+	static void ApplyTrackSample(AVRCharacter* Character, const FTrackSample& Sample)
+	{
+		if (Character->VRReplicatedCamera)
+		{
+			Character->VRReplicatedCamera->SetRelativeTransform(Sample.Head);
+		}
+
+		if (Character->LeftMotionController)
+		{
+			Character->LeftMotionController->SetRelativeTransform(Sample.LeftHand);
+		}
+
+		if (Character->RightMotionController)
+		{
+			Character->RightMotionController->SetRelativeTransform(Sample.RightHand);
+		}
+	}
+
+	// Game world that is torn down with the test, no net driver so the emulation is applied to the tracks directly
+	struct FBenchWorld
+	{
+		UWorld* World = nullptr;
+
+		FBenchWorld()
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("VRCharacterMovementBench"));
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+
+			FURL URL;
+			World->InitializeActorsForPlay(URL);
+			World->BeginPlay();
+		}
+
+		~FBenchWorld()
+		{
+			if (World)
+			{
+				GEngine->DestroyWorldContext(World);
+				World->DestroyWorld(false);
+			}
+		}
+	};
+
+	static bool SpawnFloor(UWorld* World)
+	{
+		UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+		if (!CubeMesh)
+		{
+			return false;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		// 100 unit cube scaled out to a 200m slab with its top at Z = 0
+		AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(FVector(0.0f, 0.0f, -50.0f), FRotator::ZeroRotator, SpawnParams);
+		if (!Floor)
+		{
+			return false;
+		}
+
+		UStaticMeshComponent* FloorMesh = Floor->GetStaticMeshComponent();
+		FloorMesh->SetMobility(EComponentMobility::Movable);
+		FloorMesh->SetStaticMesh(CubeMesh);
+		Floor->SetActorScale3D(FVector(200.0f, 200.0f, 1.0f));
+		return true;
+	}
+}
+
+// Spawns N VR characters driven by synthetic HMD / controller tracks that go through a latency and loss model on their way in,
+// then counts the VR root sweeps and floor queries that the load costs.
+// Parameters are "NumCharacters LagMs LossPercent".
+// Covers the character side of the cost, the move RPC path needs a real connection: run vrexp.CharacterMovement.BenchStart / BenchReport
+// on a listen server with clients using the NetEmulation.* settings for that.
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FVRCharacterMovementBenchTest, "VRExpansionPlugin.CharacterMovement.Bench", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FVRCharacterMovementBenchTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	OutBeautifiedNames.Add(TEXT("16 Characters No Loss"));
+	OutTestCommands.Add(TEXT("16 0 0"));
+
+	OutBeautifiedNames.Add(TEXT("16 Characters 100ms 5 Percent Loss"));
+	OutTestCommands.Add(TEXT("16 100 5"));
+
+	OutBeautifiedNames.Add(TEXT("64 Characters 150ms 10 Percent Loss"));
+	OutTestCommands.Add(TEXT("64 150 10"));
+}
+
+bool FVRCharacterMovementBenchTest::RunTest(const FString& Parameters)
+{
+	using namespace VRCharacterMovementBenchTests;
+
+	TArray<FString> Args;
+	Parameters.ParseIntoArrayWS(Args);
+
+	const int32 NumCharacters = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 16;
+	const float LagSeconds = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 0) / 1000.0f : 0.0f;
+	const int32 LossPercent = Args.Num() > 2 ? FMath::Clamp(FCString::Atoi(*Args[2]), 0, 100) : 0;
+
+	if (VRCharacterMovementBench::IsRecording())
+	{
+		AddWarning(TEXT("A vrexp.CharacterMovement.BenchStart recording was running, this test replaces it"));
+	}
+
+	FBenchWorld BenchWorld;
+	UWorld* World = BenchWorld.World;
+	if (!World)
+	{
+		AddError(TEXT("Could not create the bench world"));
+		return false;
+	}
+
+	if (!SpawnFloor(World))
+	{
+		AddError(TEXT("Could not spawn the floor, /Engine/BasicShapes/Cube is missing"));
+		return false;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	// Square grid far enough apart that only the walking brings them together
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)NumCharacters));
+	const float Spacing = 300.0f;
+	const FVector GridStart(-0.5f * GridSize * Spacing, -0.5f * GridSize * Spacing, 100.0f);
+
+	TArray<FSyntheticClient> Clients;
+	Clients.Reserve(NumCharacters);
+
+	for (int32 CharacterIndex = 0; CharacterIndex < NumCharacters; ++CharacterIndex)
+	{
+		const FVector SpawnLocation = GridStart + FVector((CharacterIndex % GridSize) * Spacing, (CharacterIndex / GridSize) * Spacing, 0.0f);
+		AVRCharacter* Character = World->SpawnActor<AVRCharacter>(SpawnLocation, FRotator::ZeroRotator, SpawnParams);
+		if (!Character)
+		{
+			AddError(FString::Printf(TEXT("Could not spawn character %d"), CharacterIndex));
+			return false;
+		}
+
+		// Possessed on the authority like a remote players character is, so that movement input is consumed
+		Character->AIControllerClass = AVRAIController::StaticClass();
+		Character->SpawnDefaultController();
+
+		FSyntheticClient& Client = Clients.AddDefaulted_GetRef();
+		Client.Character = Character;
+		Client.Phase = CharacterIndex * 0.37f;
+	}
+
+	// Fixed seed so that runs drop the same samples and stay comparable
+	FRandomStream LossStream(0x5652);
+	FVRSampleReservoir FrameMilliseconds(8192);
+	const int32 NumFrames = FMath::CeilToInt(BenchDuration / FrameDeltaTime);
+
+	VRCharacterMovementBench::StartRecording();
+
+	float Time = 0.0f;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		Time += FrameDeltaTime;
+
+		for (FSyntheticClient& Client : Clients)
+		{
+			AVRCharacter* Character = Client.Character.Get();
+			if (!Character)
+			{
+				continue;
+			}
+
+			if (LossStream.FRand() * 100.0f >= LossPercent)
+			{
+				Client.InFlight.Add(MakeTrackSample(Time, Client.Phase));
+			}
+
+			// Newest sample that has arrived wins, anything older that arrived with it is stale
+			int32 LastArrived = INDEX_NONE;
+			for (int32 SampleIndex = 0; SampleIndex < Client.InFlight.Num() && Client.InFlight[SampleIndex].SendTime + LagSeconds <= Time; ++SampleIndex)
+			{
+				LastArrived = SampleIndex;
+			}
+
+			if (LastArrived != INDEX_NONE)
+			{
+				ApplyTrackSample(Character, Client.InFlight[LastArrived]);
+				Client.LastMoveInput = Client.InFlight[LastArrived].MoveInput;
+				Client.InFlight.RemoveAt(0, LastArrived + 1, EAllowShrinking::No);
+			}
+
+			if (!Client.LastMoveInput.IsNearlyZero())
+			{
+				Character->AddMovementInput(Client.LastMoveInput, 1.0f);
+			}
+		}
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		World->Tick(LEVELTICK_All, FrameDeltaTime);
+		FrameMilliseconds.Add(static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles)));
+	}
+
+	const uint64 RootSweeps = VRCharacterMovementBench::GetCount(VRCharacterMovementBench::ECounter::RootSweeps);
+	const uint64 FloorQueries = VRCharacterMovementBench::GetCount(VRCharacterMovementBench::ECounter::FloorQueries);
+	const uint64 FloorCacheHits = VRCharacterMovementBench::GetCount(VRCharacterMovementBench::ECounter::FloorCacheHits);
+	VRCharacterMovementBench::StopRecording(true);
+
+	const double CharacterFrames = (double)NumCharacters * NumFrames;
+	const TArray<float> FrameSamples = FrameMilliseconds.ConsumeSorted();
+	AddInfo(FString::Printf(TEXT("%d characters, %.0fms lag, %d%% loss, %d frames: RootSweeps=%llu (%.3f per character frame) FloorQueries=%llu (%.3f per character frame) FloorCacheHits=%llu"),
+		NumCharacters, LagSeconds * 1000.0f, LossPercent, NumFrames, RootSweeps, RootSweeps / CharacterFrames, FloorQueries, FloorQueries / CharacterFrames, FloorCacheHits));
+	AddInfo(FString::Printf(TEXT("World tick ms p50=%.3f p95=%.3f p99=%.3f max=%.3f"),
+		FVRSampleReservoir::GetPercentile(FrameSamples, 0.5f), FVRSampleReservoir::GetPercentile(FrameSamples, 0.95f), FVRSampleReservoir::GetPercentile(FrameSamples, 0.99f), FrameSamples.Num() ? FrameSamples.Last() : 0.0f));
+
+	TestTrue(TEXT("VR roots swept"), RootSweeps > 0);
+
+	for (const FSyntheticClient& Client : Clients)
+	{
+		const AVRCharacter* Character = Client.Character.Get();
+		if (TestNotNull(TEXT("Character still exists"), Character))
+		{
+			TestTrue(FString::Printf(TEXT("%s stayed on the floor"), *Character->GetName()), Character->GetActorLocation().Z > -50.0f);
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
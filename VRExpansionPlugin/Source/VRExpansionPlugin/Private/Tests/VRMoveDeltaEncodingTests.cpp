@@ -0,0 +1,161 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VRMoveDeltaEncoding.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/VRNetSerializationTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace VRNetSerializationTests;
+
+namespace VRMoveDeltaEncodingTests
+{
+	static bool RoundTripTimeStamp(float TimeStamp, float Reference, float& OutTimeStamp, int64* OutNumBits = nullptr)
+	{
+		float Sent = TimeStamp;
+		OutTimeStamp = -1.0f;
+
+		return RoundTripBits(
+			[&](FArchive& Ar) { VRMoveDeltaEncoding::SerializeTimeStamp(Ar, Sent, Reference); return true; },
+			[&](FArchive& Ar) { VRMoveDeltaEncoding::SerializeTimeStamp(Ar, OutTimeStamp, Reference); return true; },
+			OutNumBits);
+	}
+
+	static bool RoundTripVector(const FVector& Value, const FVector& Reference, FVector& OutValue, int64* OutNumBits = nullptr)
+	{
+		FVector Sent = Value;
+		OutValue = FVector(-1.0);
+
+		return RoundTripBits(
+			[&](FArchive& Ar) { return VRMoveDeltaEncoding::SerializeVectorResidual<100, 30>(Ar, Sent, Reference); },
+			[&](FArchive& Ar) { return VRMoveDeltaEncoding::SerializeVectorResidual<100, 30>(Ar, OutValue, Reference); },
+			OutNumBits);
+	}
+
+	static bool RoundTripAxis(uint16 Axis, uint16 Reference, uint16& OutAxis, int64* OutNumBits = nullptr)
+	{
+		uint16 Sent = Axis;
+		OutAxis = 0;
+
+		return RoundTripBits(
+			[&](FArchive& Ar) { VRMoveDeltaEncoding::SerializeAxisResidual(Ar, Sent, Reference); return true; },
+			[&](FArchive& Ar) { VRMoveDeltaEncoding::SerializeAxisResidual(Ar, OutAxis, Reference); return true; },
+			OutNumBits);
+	}
+
+	// What FVector_NetQuantize100 would decode the value to
+	static FVector Quantize100(const FVector& Value)
+	{
+		return FVector(FMath::RoundToInt64(Value.X * 100) / 100.0, FMath::RoundToInt64(Value.Y * 100) / 100.0, FMath::RoundToInt64(Value.Z * 100) / 100.0);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRMoveDeltaEncodingZigZagTest, "VRExpansionPlugin.NetSerialization.MoveDeltaEncoding.ZigZag", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRMoveDeltaEncodingZigZagTest::RunTest(const FString& Parameters)
+{
+	using namespace VRMoveDeltaEncoding;
+
+	TestEqual(TEXT("Zero"), ZigZag(0), 0u);
+	TestEqual(TEXT("Minus one"), ZigZag(-1), 1u);
+	TestEqual(TEXT("One"), ZigZag(1), 2u);
+
+	const int32 Values[] = { 0, 1, -1, 2, -2, 12345, -12345, MAX_int32, MIN_int32 };
+	for (int32 Value : Values)
+	{
+		TestEqual(FString::Printf(TEXT("Round trip %d"), Value), UnZigZag(ZigZag(Value)), Value);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRMoveDeltaEncodingTimeStampTest, "VRExpansionPlugin.NetSerialization.MoveDeltaEncoding.TimeStamp", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRMoveDeltaEncodingTimeStampTest::RunTest(const FString& Parameters)
+{
+	using namespace VRMoveDeltaEncodingTests;
+
+	float Received = 0.0f;
+	int64 DeltaBits = 0;
+	int64 FallbackBits = 0;
+
+	// Older move a few frames before the reference, the common case, has to be exact
+	TestTrue(TEXT("Delta round trip"), RoundTripTimeStamp(100.2345f, 100.2678f, Received, &DeltaBits));
+	TestEqual(TEXT("Delta exact"), Received, 100.2345f);
+
+	TestTrue(TEXT("Same stamp round trip"), RoundTripTimeStamp(42.5f, 42.5f, Received));
+	TestEqual(TEXT("Same stamp exact"), Received, 42.5f);
+
+	TestTrue(TEXT("Zero round trip"), RoundTripTimeStamp(0.0f, 0.011f, Received));
+	TestEqual(TEXT("Zero exact"), Received, 0.0f);
+
+	// Timestamp reset between the moves, newer than the reference, sends the full float
+	TestTrue(TEXT("Reset round trip"), RoundTripTimeStamp(250.125f, 0.5f, Received, &FallbackBits));
+	TestEqual(TEXT("Reset exact"), Received, 250.125f);
+	TestTrue(TEXT("Delta is smaller than the fallback"), DeltaBits < FallbackBits);
+
+	// Too many float steps apart for the delta
+	TestTrue(TEXT("Far round trip"), RoundTripTimeStamp(0.001f, 1000.0f, Received));
+	TestEqual(TEXT("Far exact"), Received, 0.001f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRMoveDeltaEncodingVectorTest, "VRExpansionPlugin.NetSerialization.MoveDeltaEncoding.VectorResidual", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRMoveDeltaEncodingVectorTest::RunTest(const FString& Parameters)
+{
+	using namespace VRMoveDeltaEncodingTests;
+
+	FVector Received;
+	int64 SameBits = 0;
+	int64 ResidualBits = 0;
+	int64 FallbackBits = 0;
+
+	const FVector Reference(1520.337, -48213.5, 92.01);
+
+	// Same value at the quantized precision is the 2 bit mode only
+	TestTrue(TEXT("Same round trip"), RoundTripVector(Reference + FVector(0.001), Reference, Received, &SameBits));
+	TestEqual(TEXT("Same bits"), SameBits, (int64)2);
+	TestTrue(TEXT("Same decodes to the quantized reference"), Received.Equals(Quantize100(Reference), 0.0));
+
+	// Residuals decode to exactly what a full FVector_NetQuantize100 would have
+	const FVector Moved = Reference + FVector(2.5, -0.37, 0.0);
+	TestTrue(TEXT("Residual round trip"), RoundTripVector(Moved, Reference, Received, &ResidualBits));
+	TestTrue(TEXT("Residual decodes to the quantized value"), Received.Equals(Quantize100(Moved), UE_DOUBLE_KINDA_SMALL_NUMBER));
+
+	// Negative and positive residuals on every axis
+	const FVector Mixed = Reference + FVector(-150.0, 0.01, 3000.99);
+	TestTrue(TEXT("Mixed round trip"), RoundTripVector(Mixed, Reference, Received));
+	TestTrue(TEXT("Mixed decodes to the quantized value"), Received.Equals(Quantize100(Mixed), UE_DOUBLE_KINDA_SMALL_NUMBER));
+
+	// Residual out of range falls back to the packed vector
+	const FVector Far(2.0e7, 0.0, -1.0);
+	TestTrue(TEXT("Fallback round trip"), RoundTripVector(Far, FVector::ZeroVector, Received, &FallbackBits));
+	TestTrue(TEXT("Fallback error"), MaxAxisError(Received, Far) <= 0.01);
+	TestTrue(TEXT("Residual is smaller than the fallback"), ResidualBits < FallbackBits);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRMoveDeltaEncodingAxisTest, "VRExpansionPlugin.NetSerialization.MoveDeltaEncoding.AxisResidual", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVRMoveDeltaEncodingAxisTest::RunTest(const FString& Parameters)
+{
+	using namespace VRMoveDeltaEncodingTests;
+
+	uint16 Received = 0;
+	int64 WrapBits = 0;
+
+	const uint16 Pairs[][2] = { { 100, 100 }, { 120, 100 }, { 80, 100 }, { 0, 65535 }, { 65535, 0 }, { 32768, 0 }, { 0, 32768 } };
+	for (const uint16* Pair : Pairs)
+	{
+		TestTrue(FString::Printf(TEXT("Round trip %d against %d"), Pair[0], Pair[1]), RoundTripAxis(Pair[0], Pair[1], Received));
+		TestEqual(FString::Printf(TEXT("Exact %d against %d"), Pair[0], Pair[1]), Received, Pair[0]);
+	}
+
+	// Crossing the wrap point is a one step residual, not a full turn
+	TestTrue(TEXT("Wrap round trip"), RoundTripAxis(1, 65534, Received, &WrapBits));
+	TestEqual(TEXT("Wrap exact"), Received, (uint16)1);
+	TestTrue(TEXT("Wrap stays small"), WrapBits <= 8);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
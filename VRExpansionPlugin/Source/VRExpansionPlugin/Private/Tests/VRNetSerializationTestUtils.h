@@ -0,0 +1,52 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Serialization/BitWriter.h"
+#include "Serialization/BitReader.h"
+
+namespace VRNetSerializationTests
+{
+	// Writes with WriteFunc then reads the same bits back with ReadFunc
+	// Fails if either side reports failure, the archives error, or the reader doesn't consume exactly what was written
+	template<typename WriteFuncType, typename ReadFuncType>
+	bool RoundTripBits(WriteFuncType&& WriteFunc, ReadFuncType&& ReadFunc, int64* OutNumBits = nullptr)
+	{
+		FBitWriter Writer(0, /*AllowResize=*/ true);
+		if (!WriteFunc(Writer) || Writer.IsError())
+		{
+			return false;
+		}
+
+		if (OutNumBits)
+		{
+			*OutNumBits = Writer.GetNumBits();
+		}
+
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		if (!ReadFunc(Reader) || Reader.IsError())
+		{
+			return false;
+		}
+
+		return Reader.GetPosBits() == Writer.GetNumBits();
+	}
+
+	// Angle between two rotations in degrees
+	inline double AngleBetweenDegrees(const FQuat& A, const FQuat& B)
+	{
+		return FMath::RadiansToDegrees(A.GetNormalized().AngularDistance(B.GetNormalized()));
+	}
+
+	// Largest per axis difference between two vectors
+	inline double MaxAxisError(const FVector& A, const FVector& B)
+	{
+		return (A - B).GetAbsMax();
+	}
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
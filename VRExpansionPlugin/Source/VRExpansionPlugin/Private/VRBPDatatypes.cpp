@@ -8,6 +8,7 @@
 #include "Components/PrimitiveComponent.h"
 #include "HAL/IConsoleManager.h"
 #include "Chaos/ChaosEngineInterface.h"
+#include "Engine/NetConnection.h"
 
 namespace VRDataTypeCVARs
 {
@@ -99,6 +100,329 @@ bool FTransform_NetQuantize::NetSerialize(FArchive& Ar, class UPackageMap* Map,
 	return bOutSuccess;
 }
 
+bool FTransform_NetQuantize::NetSerializeWithProfile(EVRTransformQuantizationProfile Profile, FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	// High precision overrides all profiles
+	if (Profile == EVRTransformQuantizationProfile::Default || VRDataTypeCVARs::RepHighPrecisionTransforms > 0)
+	{
+		return NetSerialize(Ar, Map, bOutSuccess);
+	}
+
+	bOutSuccess = true;
+
+	// Range of the hand local profile in UU, 16 bits w/ sign gives ~0.006 UU precision
+	static constexpr uint32 HandLocalRange = 200;
+
+	FVector rTranslation = FVector::ZeroVector;
+	FVector rScale3D = FVector::OneVector;
+	FQuat rRotation = FQuat::Identity;
+	uint8 bInRange = 1;
+	uint8 bUnitScale = 1;
+
+	if (Ar.IsSaving())
+	{
+		rTranslation = this->GetTranslation();
+		rScale3D = this->GetScale3D();
+		rRotation = this->GetRotation();
+
+		if (Profile == EVRTransformQuantizationProfile::HandLocal)
+		{
+			bInRange = FMath::Abs(rTranslation.X) <= HandLocalRange && FMath::Abs(rTranslation.Y) <= HandLocalRange && FMath::Abs(rTranslation.Z) <= HandLocalRange;
+		}
+
+		// Within what the 2 decimal scale quantization would have rounded to anyway
+		bUnitScale = rScale3D.Equals(FVector::OneVector, 0.005f);
+	}
+
+	switch (Profile)
+	{
+	case EVRTransformQuantizationProfile::HandLocal:
+	{
+		Ar.SerializeBits(&bInRange, 1);
+
+		if (bInRange)
+		{
+			bOutSuccess &= SerializeFixedVector<HandLocalRange, 16>(rTranslation, Ar);
+		}
+		else
+		{
+			bOutSuccess &= SerializePackedVector<100, 30>(rTranslation, Ar);
+		}
+
+		FTransform_NetQuantize::SerializeQuat_SmallestThree<15>(Ar, rRotation);
+	}break;
+
+	case EVRTransformQuantizationProfile::WorldSpace:
+	default:
+	{
+		bOutSuccess &= SerializePackedVector<10, 24>(rTranslation, Ar);
+		FTransform_NetQuantize::SerializeQuat_SmallestThree<12>(Ar, rRotation);
+	}break;
+	}
+
+	Ar.SerializeBits(&bUnitScale, 1);
+
+	if (!bUnitScale)
+	{
+		bOutSuccess &= SerializePackedVector<100, 30>(rScale3D, Ar);
+	}
+	else if (Ar.IsLoading())
+	{
+		rScale3D = FVector::OneVector;
+	}
+
+	if (Ar.IsLoading())
+	{
+		this->SetComponents(rRotation, rTranslation, rScale3D);
+		this->NormalizeRotation();
+	}
+
+	return bOutSuccess;
+}
+
+// ** Pose Jitter Buffer ** //
+
+void FBPVRPoseJitterBuffer::Reset()
+{
+	Samples.Reset();
+	bHasExtrapolationBase = false;
+}
+
+void FBPVRPoseJitterBuffer::AddSample(double ArrivalTime, const FBPVRComponentPosRep& Pose, const FVector& Position)
+{
+	if (!Pose.bHasSenderTime)
+	{
+		// Sender isn't stamping its poses, fall back to arrival times
+		if (bUsingSenderClock)
+		{
+			Reset();
+			bUsingSenderClock = false;
+			bHasSenderClock = false;
+			ClockOffset = 0.0;
+		}
+
+		AddSample(ArrivalTime, Position, Pose.Rotation.Quaternion());
+		return;
+	}
+
+	if (!bUsingSenderClock)
+	{
+		Reset();
+		bUsingSenderClock = true;
+	}
+
+	// The 16 bit stamp only unwraps correctly across gaps shorter than half of its range
+	if (!bHasSenderClock || (ArrivalTime - LastArrivalTime) > 30.0)
+	{
+		Reset();
+		bHasSenderClock = true;
+		UnwrappedSenderTime = 0.0;
+		LastSenderTimeMs = Pose.SenderTimeMs;
+		ClockOffset = ArrivalTime;
+	}
+	else
+	{
+		const int16 DeltaMs = (int16)(uint16)(Pose.SenderTimeMs - LastSenderTimeMs);
+
+		// Out of order arrivals are dropped, the RPCs are unreliable so this can happen
+		if (DeltaMs < 0)
+		{
+			return;
+		}
+
+		UnwrappedSenderTime += DeltaMs / 1000.0;
+		LastSenderTimeMs = Pose.SenderTimeMs;
+
+		// Follow the least delayed arrival, relaxing upwards slowly so that clock drift and route changes are still tracked
+		const double ArrivalOffset = ArrivalTime - UnwrappedSenderTime;
+		ClockOffset = ArrivalOffset < ClockOffset ? ArrivalOffset : ClockOffset + (ArrivalOffset - ClockOffset) * 0.01;
+	}
+
+	LastArrivalTime = ArrivalTime;
+	AddSample(UnwrappedSenderTime, Position, Pose.Rotation.Quaternion());
+}
+
+void FBPVRPoseJitterBuffer::AddSample(double Timestamp, const FVector& Position, const FQuat& Rotation)
+{
+	// Out of order arrivals are dropped, the RPCs are unreliable so this can happen
+	if (Samples.Num() > 0 && Timestamp < Samples.Last().Timestamp)
+	{
+		return;
+	}
+
+	FQuat NewRotation = Rotation.GetNormalized();
+
+	// Keep rotations in the same hemisphere so that the interpolation takes the short path
+	if (Samples.Num() > 0 && (Samples.Last().Rotation | NewRotation) < 0.0f)
+	{
+		NewRotation = -NewRotation;
+	}
+
+	if (Samples.Num() >= FMath::Max(MaxBufferedSamples, 2))
+	{
+		ExtrapolationBase = Samples[Samples.Num() - FMath::Max(MaxBufferedSamples, 2)];
+		bHasExtrapolationBase = true;
+		Samples.RemoveAt(0, Samples.Num() - FMath::Max(MaxBufferedSamples, 2) + 1, EAllowShrinking::No);
+	}
+
+	Samples.Emplace(Timestamp, Position, NewRotation);
+}
+
+bool FBPVRPoseJitterBuffer::SamplePose(double CurrentTime, FVector& OutPosition, FQuat& OutRotation, bool& bOutIsExtrapolating)
+{
+	bOutIsExtrapolating = false;
+
+	if (Samples.Num() < 1)
+	{
+		return false;
+	}
+
+	// Samples are in the senders time when it stamps them, ClockOffset is zero otherwise
+	const double RenderTime = CurrentTime - ClockOffset - (BufferDelayMs / 1000.0);
+
+	// Still waiting on the buffer to fill, hold the oldest sample
+	if (RenderTime <= Samples[0].Timestamp)
+	{
+		OutPosition = Samples[0].Position;
+		OutRotation = Samples[0].Rotation;
+		return true;
+	}
+
+	// Drop samples that are entirely behind the playback time, we always keep one sample prior to it to interpolate from
+	int32 FirstNeededIndex = 0;
+	while (FirstNeededIndex + 1 < Samples.Num() && Samples[FirstNeededIndex + 1].Timestamp <= RenderTime)
+	{
+		++FirstNeededIndex;
+	}
+
+	if (FirstNeededIndex > 0)
+	{
+		// Keep the newest dropped sample around so that we still have a velocity if the buffer runs dry
+		ExtrapolationBase = Samples[FirstNeededIndex - 1];
+		bHasExtrapolationBase = true;
+		Samples.RemoveAt(0, FirstNeededIndex, EAllowShrinking::No);
+	}
+
+	if (Samples.Num() > 1)
+	{
+		const FBPVRPoseJitterSample& From = Samples[0];
+		const FBPVRPoseJitterSample& To = Samples[1];
+		const double Duration = To.Timestamp - From.Timestamp;
+		const float Alpha = Duration > UE_SMALL_NUMBER ? (float)FMath::Clamp((RenderTime - From.Timestamp) / Duration, 0.0, 1.0) : 1.0f;
+
+		OutPosition = FMath::Lerp(From.Position, To.Position, Alpha);
+		OutRotation = FQuat::Slerp(From.Rotation, To.Rotation, Alpha).GetNormalized();
+		return true;
+	}
+
+	// Buffer ran dry, extrapolate off of the velocity between the last two samples we received
+	const FBPVRPoseJitterSample& Newest = Samples.Last();
+	OutPosition = Newest.Position;
+	OutRotation = Newest.Rotation;
+
+	if (!bHasExtrapolationBase || MaxExtrapolationMs <= 0.0f)
+	{
+		return true;
+	}
+
+	const double BaseDuration = Newest.Timestamp - ExtrapolationBase.Timestamp;
+	if (BaseDuration <= UE_SMALL_NUMBER)
+	{
+		return true;
+	}
+
+	const float ExtrapolationTime = (float)FMath::Min(RenderTime - Newest.Timestamp, (double)MaxExtrapolationMs / 1000.0);
+	bOutIsExtrapolating = true;
+
+	FVector LinearVelocity = (Newest.Position - ExtrapolationBase.Position) / BaseDuration;
+	LinearVelocity = LinearVelocity.GetClampedToMaxSize(MaxExtrapolationVelocity);
+	OutPosition += LinearVelocity * ExtrapolationTime;
+
+	FVector Axis;
+	double Angle;
+	(Newest.Rotation * ExtrapolationBase.Rotation.Inverse()).GetNormalized().ToAxisAndAngle(Axis, Angle);
+	Angle = FMath::UnwindRadians(Angle);
+
+	double AngularSpeed = Angle / BaseDuration;
+	const double MaxAngularSpeed = FMath::DegreesToRadians(MaxExtrapolationAngularVelocity);
+	AngularSpeed = FMath::Clamp(AngularSpeed, -MaxAngularSpeed, MaxAngularSpeed);
+
+	OutRotation = (FQuat(Axis, AngularSpeed * ExtrapolationTime) * Newest.Rotation).GetNormalized();
+	return true;
+}
+
+bool FBPVRPoseJitterBuffer::HasFinishedPlayback(double CurrentTime) const
+{
+	if (Samples.Num() < 1)
+	{
+		return true;
+	}
+
+	const double RenderTime = CurrentTime - ClockOffset - (BufferDelayMs / 1000.0);
+	return RenderTime >= Samples.Last().Timestamp + (FMath::Max(MaxExtrapolationMs, 0.0f) / 1000.0);
+}
+
+bool FBPVRPoseJitterBuffer::GetNewestPosition(FVector& OutPosition) const
+{
+	if (Samples.Num() < 1)
+	{
+		return false;
+	}
+
+	OutPosition = Samples.Last().Position;
+	return true;
+}
+
+// ** Adaptive Net Update ** //
+
+float FBPVRAdaptiveNetUpdateSettings::GetAdaptiveUpdateRate(float BaseUpdateRate, const FVector& NewPosition, const FRotator& NewRotation, const FVector& LastSentPosition, const FRotator& LastSentRotation, float TimeSinceLastSend, bool bConnectionSaturated) const
+{
+	const float PositionDelta = FVector::Dist(NewPosition, LastSentPosition);
+	const float RotationDelta = FMath::RadiansToDegrees(NewRotation.Quaternion().AngularDistance(LastSentRotation.Quaternion()));
+
+	// Still within the idle thresholds, only send a refresh every so often
+	if (PositionDelta <= PositionThreshold && RotationDelta <= RotationThreshold)
+	{
+		if (MaxIdleSendInterval <= 0.0f || TimeSinceLastSend < MaxIdleSendInterval)
+		{
+			return 0.0f;
+		}
+
+		return BaseUpdateRate;
+	}
+
+	float UpdateRate = BaseUpdateRate;
+
+	if (TimeSinceLastSend > 0.0f && FastMotionUpdateRate > UpdateRate)
+	{
+		if (PositionDelta / TimeSinceLastSend >= FastMotionVelocity || RotationDelta / TimeSinceLastSend >= FastMotionAngularVelocity)
+		{
+			UpdateRate = FastMotionUpdateRate;
+		}
+	}
+
+	if (bConnectionSaturated && SaturatedUpdateRate > 0.0f)
+	{
+		UpdateRate = FMath::Min(UpdateRate, SaturatedUpdateRate);
+	}
+
+	return UpdateRate;
+}
+
+bool FBPVRAdaptiveNetUpdateSettings::IsOwningConnectionSaturated(const AActor* OwningActor)
+{
+	// Only the owning client sends poses up through its connection
+	if (OwningActor && OwningActor->GetNetMode() == NM_Client)
+	{
+		if (UNetConnection* NetConnection = OwningActor->GetNetConnection())
+		{
+			return !NetConnection->IsNetReady();
+		}
+	}
+
+	return false;
+}
+
 // ** Euro Low Pass Filter ** //
 
 void FBPEuroLowPassFilter::ResetSmoothingFilter()
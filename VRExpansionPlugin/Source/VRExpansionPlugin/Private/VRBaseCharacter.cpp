@@ -13,6 +13,8 @@
 #include "VRRootComponent.h"
 #include "VRPathFollowingComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Engine/ActorChannel.h"
+#include "Engine/NetConnection.h"
 #include "XRMotionControllerBase.h"
 #include "NavFilters/NavigationQueryFilter.h"
 //#include "Runtime/Engine/Private/EnginePrivate.h"
@@ -151,6 +153,12 @@ AVRBaseCharacter::AVRBaseCharacter(const FObjectInitializer& ObjectInitializer)
 
 	VRReplicateCapsuleHeight = false;
 
+	bUseDistanceBasedPoseReplication = false;
+	PoseReplicationNearDistance = 1000.0f;
+	PoseReplicationFarDistance = 4000.0f;
+	PoseReplicationNearRate = 60.0f;
+	PoseReplicationFarRate = 10.0f;
+
 	bUseExperimentalUnseatModeFix = true;
 
 	ReplicatedMovementVR.Owner = this;
@@ -268,6 +276,122 @@ void AVRBaseCharacter::PreReplication(IRepChangedPropertyTracker & ChangedProper
 	DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(AVRBaseCharacter, ReplicatedMovementVR, IsReplicatingMovement());
 }
 
+// Version of the replicated state on a tracked component that isn't its pose
+static uint32 GetTrackedComponentStateVersion(const UActorComponent* TrackedComponent)
+{
+	if (const UGripMotionControllerComponent* MotionController = Cast<UGripMotionControllerComponent>(TrackedComponent))
+	{
+		return MotionController->NonPoseReplicationVersion;
+	}
+	else if (const UReplicatedVRCameraComponent* Camera = Cast<UReplicatedVRCameraComponent>(TrackedComponent))
+	{
+		return Camera->NonPoseReplicationVersion;
+	}
+
+	return 0;
+}
+
+bool AVRBaseCharacter::ReplicateSubobjects(UActorChannel* Channel, class FOutBunch* Bunch, FReplicationFlags* RepFlags)
+{
+	// The registered sub object list never calls into here, those characters replicate the tracked components at full rate
+	if (!bUseDistanceBasedPoseReplication || IsUsingRegisteredSubObjectList() || !Channel || !Channel->Connection)
+	{
+		return Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
+	}
+
+	const UActorComponent* TrackedComponents[3] = { VRReplicatedCamera, LeftMotionController, RightMotionController };
+
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+	const float PoseInterval = GetPoseReplicationInterval(Channel->Connection);
+
+	FVRPoseReplicationConnectionState* ConnectionState = PoseReplicationConnectionStates.Find(Channel->Connection);
+	if (!ConnectionState)
+	{
+		// New connections are rare, clear out the ones that closed before adding
+		PrunePoseReplicationConnectionStates();
+		ConnectionState = &PoseReplicationConnectionStates.Add(Channel->Connection);
+	}
+
+	if (PoseInterval <= 0.0f || (CurrentTime - ConnectionState->LastReplicationTime) >= PoseInterval)
+	{
+		ConnectionState->LastReplicationTime = CurrentTime;
+		for (int32 TrackedIndex = 0; TrackedIndex < 3; ++TrackedIndex)
+		{
+			ConnectionState->SentStateVersions[TrackedIndex] = GetTrackedComponentStateVersion(TrackedComponents[TrackedIndex]);
+		}
+
+		return Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
+	}
+
+	// Hold back the tracked components poses for this connection this frame, their changes accumulate
+	// in the connections changelist and go out together on the next allowed update.
+	bool WroteSomething = false;
+	for (UActorComponent* ActorComp : GetReplicatedComponents())
+	{
+		if (!ActorComp || !ActorComp->GetIsReplicated())
+			continue;
+
+		// Sub objects (grip scripts) are never held back
+		WroteSomething |= ActorComp->ReplicateSubobjects(Channel, Bunch, RepFlags);
+
+		int32 TrackedIndex = INDEX_NONE;
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			if (TrackedComponents[Index] == ActorComp)
+			{
+				TrackedIndex = Index;
+				break;
+			}
+		}
+
+		if (TrackedIndex != INDEX_NONE)
+		{
+			// Only the pose is throttled, grips and settings changes go out right away (along with the pending pose)
+			const uint32 StateVersion = GetTrackedComponentStateVersion(ActorComp);
+			if (StateVersion == ConnectionState->SentStateVersions[TrackedIndex])
+				continue;
+
+			ConnectionState->SentStateVersions[TrackedIndex] = StateVersion;
+		}
+
+		WroteSomething |= Channel->ReplicateSubobject(ActorComp, *Bunch, *RepFlags);
+	}
+
+	return WroteSomething;
+}
+
+void AVRBaseCharacter::PrunePoseReplicationConnectionStates()
+{
+	for (auto It = PoseReplicationConnectionStates.CreateIterator(); It; ++It)
+	{
+		const UNetConnection* Connection = It.Key().ResolveObjectPtr();
+		if (!Connection || Connection->GetConnectionState() == USOCK_Closed)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+float AVRBaseCharacter::GetPoseReplicationInterval(const UNetConnection* Connection) const
+{
+	if (!Connection || !Connection->ViewTarget || Connection->ViewTarget == this)
+	{
+		return 0.0f;
+	}
+
+	const float ViewDistance = FVector::Dist(Connection->ViewTarget->GetActorLocation(), GetActorLocation());
+
+	if (ViewDistance <= PoseReplicationNearDistance)
+	{
+		return 0.0f;
+	}
+
+	const float FarAlpha = FMath::GetRangePct(PoseReplicationNearDistance, FMath::Max(PoseReplicationFarDistance, PoseReplicationNearDistance + 1.0f), ViewDistance);
+	const float UpdateRate = FMath::Lerp(PoseReplicationNearRate, PoseReplicationFarRate, FMath::Clamp(FarAlpha, 0.0f, 1.0f));
+
+	return UpdateRate > 0.0f ? 1.0f / UpdateRate : 0.0f;
+}
+
 /*USkeletalMeshComponent* AVRBaseCharacter::GetIKMesh_Implementation() const
 {
 	return GetMesh();
@@ -19,11 +19,18 @@
 #include "Navigation/PathFollowingComponent.h"
 #include "VRPlayerController.h"
 #include "GameFramework/PhysicsVolume.h"
+#include "Camera/PlayerCameraManager.h"
 #include "Animation/AnimInstance.h"
+#include "VRCharacterMovementBench.h"
 
 
 DEFINE_LOG_CATEGORY(LogVRBaseCharacterMovement);
 
+DECLARE_STATS_GROUP(TEXT("VRCharacterMovement"), STATGROUP_VRCharacterMovement, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("VRCharacterMovement ServerMove HandleMoveData"), STAT_VRCharacterMovementServerHandleMoveData, STATGROUP_VRCharacterMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRCharacterMovement Floor Queries"), STAT_VRCharacterMovementFloorQueries, STATGROUP_VRCharacterMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRCharacterMovement Floor Cache Hits"), STAT_VRCharacterMovementFloorCacheHits, STATGROUP_VRCharacterMovement);
+
 UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -57,6 +64,8 @@ UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObje
 	DefaultPostClimbMovement = EVRConjoinedMovementModes::C_MOVE_Falling;
 
 	bIgnoreSimulatingComponentsInFloorCheck = true;
+	bCacheFloorResults = false;
+	FloorCacheLocationTolerance = 0.01f; // Rounded minimum of root movement
 
 	VRWallSlideScaler = 1.0f;
 	VRLowGravWallFrictionScaler = 1.0f;
@@ -82,8 +91,23 @@ UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObje
 
 	bUseClientControlRotation = true;
 	bDisableSimulatedTickWhenSmoothingMovement = true;
+	bUseSimulatedProxyLOD = false;
+	SimulatedProxyLODDistance = 3000.0f;
+	SimulatedProxyLODUpdateRate = 15.0f;
+	SimulatedProxyRepulsionDistance = 1000.0f;
 	bCapHMDMovementToMaxMovementSpeed = false;
 
+	bUseRelaxedMoveCombining = false;
+	RelaxedCombineCapsuleHeightTolerance = 1.0f;
+	RelaxedCombineMaxVRSpeed = 1000.0f;
+	RelaxedCombineVROffsetTolerance = 1.0f;
+	bDeltaEncodeMoveData = true;
+	bCompactClientCorrections = true;
+	MinTimeBetweenClientCorrections = 0.0f;
+	ClientCorrectionErrorGrowthFactor = 1.5f;
+	bMergeReplayMoves = false;
+	ReplayMergeMoveThreshold = 10;
+
 	SetNetworkMoveDataContainer(VRNetworkMoveDataContainer);
 	SetMoveResponseDataContainer(VRMoveResponseDataContainer);
 }
@@ -109,6 +133,9 @@ void UVRBaseCharacterMovementComponent::OnMovementModeChanged(EMovementMode Prev
 	// Clear out the old custom input vector, it will pollute the pool now that all modes allow it.
 	CustomVRInputVector = FVector::ZeroVector;
 
+	// Floor queries from the old mode shouldn't carry over
+	InvalidateFloorCache();
+
 	if (PreviousMovementMode == EMovementMode::MOVE_Custom && PreviousCustomMode == (uint8)EVRCustomMovementMode::VRMOVE_Seated)
 	{
 		if (MovementMode != EMovementMode::MOVE_Custom || CustomMovementMode != (uint8)EVRCustomMovementMode::VRMOVE_Seated)
@@ -215,33 +242,15 @@ bool UVRBaseCharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
 	const FVector Orig_RequestedVelocity = RequestedVelocity;
 	const bool Orig_HasRequestedVelocity = HasRequestedVelocity();
 
+	// Past the threshold contiguous compatible moves are replayed as a single step
+	const bool bMergeReplay = bMergeReplayMoves && ClientData->SavedMoves.Num() > ReplayMergeMoveThreshold;
+	const float MaxReplayStepDelta = ClientData->MaxMoveDeltaTime * CharacterOwner->GetActorTimeDilation();
+
 	// Replay moves that have not yet been acked.
 	UE_LOG(LogNetPlayerMovement, Verbose, TEXT("ClientUpdatePositionAfterServerUpdate Replaying %d Moves, starting at Timestamp %f"), ClientData->SavedMoves.Num(), ClientData->SavedMoves[0]->TimeStamp);
 	for (int32 i = 0; i < ClientData->SavedMoves.Num(); i++)
 	{
-		FSavedMove_Character* const CurrentMove = ClientData->SavedMoves[i].Get();
-		checkSlow(CurrentMove != nullptr);
-
-		// Make current SavedMove accessible to any functions that might need it.
-		SetCurrentReplayedSavedMove(CurrentMove);
-
-		CurrentMove->PrepMoveFor(CharacterOwner);
-
-		if (ShouldUsePackedMovementRPCs())
-		{
-			// Make current move data accessible to MoveAutonomous or any other functions that might need it.
-			if (FCharacterNetworkMoveData* NewMove = GetNetworkMoveDataContainer().GetNewMoveData())
-			{
-				SetCurrentNetworkMoveData(NewMove);
-				NewMove->ClientFillNetworkMoveData(*CurrentMove, FCharacterNetworkMoveData::ENetworkMoveType::NewMove);
-			}
-		}
-
-		MoveAutonomous(CurrentMove->TimeStamp, CurrentMove->DeltaTime, CurrentMove->GetCompressedFlags(), CurrentMove->Acceleration);
-
-		CurrentMove->PostUpdate(CharacterOwner, FSavedMove_Character::PostUpdate_Replay);
-		SetCurrentNetworkMoveData(nullptr);
-		SetCurrentReplayedSavedMove(nullptr);
+		i = ReplaySavedMoveStep(*ClientData, i, bMergeReplay, MaxReplayStepDelta);
 	}
 	const bool bPostReplayPressedJump = CharacterOwner->bPressedJump;
 
@@ -286,6 +295,9 @@ bool UVRBaseCharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
 void UVRBaseCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 
+	// Set again by SimulatedTick if this is a far proxy skipping the frame
+	bSimulatedProxyLODSkippedFrame = false;
+
 	// Skip calling into BP if we aren't locally controlled
 	if (CharacterOwner->IsLocallyControlled() && GetReplicatedMovementMode() == EVRConjoinedMovementModes::C_VRMOVE_Climbing)
 	{
@@ -398,7 +410,8 @@ void UVRBaseCharacterMovementComponent::TickComponent(float DeltaTime, enum ELev
 				{
 					// If we didn't move the capsule, have it update itself here so the visual and physics representation is correct
 					// We do this specifically to avoid double calling into the render / physics threads.
-					if (!VRRoot->bCalledUpdateTransform)
+					// Far proxies that skipped their tick this frame leave it for their next update
+					if (!VRRoot->bCalledUpdateTransform && !bSimulatedProxyLODSkippedFrame)
 						VRRoot->OnUpdateTransform_Public(EUpdateTransformFlags::None, ETeleportType::None);
 				}
 
@@ -547,6 +560,74 @@ bool UVRBaseCharacterMovementComponent::FloorSweepTest(
 }
 
 void UVRBaseCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const
+{
+	INC_DWORD_STAT(STAT_VRCharacterMovementFloorQueries);
+	VRCharacterMovementBench::AddCount(VRCharacterMovementBench::ECounter::FloorQueries);
+
+	// A supplied downward sweep is newer information than the cache, don't mix them
+	if (!bCacheFloorResults || (DownwardSweepResult != NULL && DownwardSweepResult->IsValidBlockingHit()))
+	{
+		InvalidateFloorCache();
+		ComputeFloorDistVR(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, DownwardSweepResult);
+		return;
+	}
+
+	float PawnRadius, PawnHalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(PawnRadius, PawnHalfHeight);
+	const FVector GravityDir = GetGravityDirection();
+
+	if (FloorCache.FrameCounter == GFrameCounter &&
+		FMath::IsNearlyEqual(FloorCache.LineDistance, LineDistance) &&
+		FMath::IsNearlyEqual(FloorCache.SweepDistance, SweepDistance) &&
+		FMath::IsNearlyEqual(FloorCache.SweepRadius, SweepRadius) &&
+		FMath::IsNearlyEqual(FloorCache.HalfHeight, PawnHalfHeight) &&
+		FloorCache.GravityDirection.Equals(GravityDir) &&
+		FVector::DistSquared(FloorCache.CapsuleLocation, CapsuleLocation) <= FMath::Square(FloorCacheLocationTolerance))
+	{
+		// The base moving invalidates the result, a missing base (no hit) can't move
+		bool bBaseUnchanged = true;
+		if (FloorCache.FloorResult.bBlockingHit)
+		{
+			const UPrimitiveComponent* CachedBase = FloorCache.BaseComponent.Get();
+			bBaseUnchanged = CachedBase && CachedBase->GetComponentTransform().Equals(FloorCache.BaseTransform, UE_KINDA_SMALL_NUMBER);
+		}
+
+		if (bBaseUnchanged)
+		{
+			INC_DWORD_STAT(STAT_VRCharacterMovementFloorCacheHits);
+			VRCharacterMovementBench::AddCount(VRCharacterMovementBench::ECounter::FloorCacheHits);
+
+			OutFloorResult = FloorCache.FloorResult;
+
+			// Account for the sub tolerance offset along gravity so that the floor distance stays exact
+			if (OutFloorResult.bBlockingHit)
+			{
+				const float HeightOffset = RotateWorldToGravity(CapsuleLocation - FloorCache.CapsuleLocation).Z;
+				OutFloorResult.FloorDist += HeightOffset;
+				if (OutFloorResult.bLineTrace)
+				{
+					OutFloorResult.LineDist += HeightOffset;
+				}
+			}
+			return;
+		}
+	}
+
+	ComputeFloorDistVR(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, DownwardSweepResult);
+
+	FloorCache.FloorResult = OutFloorResult;
+	FloorCache.CapsuleLocation = CapsuleLocation;
+	FloorCache.GravityDirection = GravityDir;
+	FloorCache.LineDistance = LineDistance;
+	FloorCache.SweepDistance = SweepDistance;
+	FloorCache.SweepRadius = SweepRadius;
+	FloorCache.HalfHeight = PawnHalfHeight;
+	FloorCache.BaseComponent = OutFloorResult.HitResult.GetComponent();
+	FloorCache.BaseTransform = FloorCache.BaseComponent.IsValid() ? FloorCache.BaseComponent->GetComponentTransform() : FTransform::Identity;
+	FloorCache.FrameCounter = GFrameCounter;
+}
+
+void UVRBaseCharacterMovementComponent::ComputeFloorDistVR(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const
 {
 	UE_LOG(LogVRBaseCharacterMovement, VeryVerbose, TEXT("[Role:%d] ComputeFloorDist: %s at location %s"), (int32)CharacterOwner->GetLocalRole(), *GetNameSafe(CharacterOwner), *CapsuleLocation.ToString());
 	OutFloorResult.Clear();
@@ -768,6 +849,222 @@ void UVRBaseCharacterMovementComponent::ClearCustomReplicatedMovement()
 	CustomVRInputVector = FVector::ZeroVector;
 }
 
+float UVRBaseCharacterMovementComponent::GetMaxVROffsetForMove(float DeltaTime) const
+{
+	return (RelaxedCombineMaxVRSpeed * FMath::Max(DeltaTime, 0.0f)) + RelaxedCombineVROffsetTolerance;
+}
+
+bool UVRBaseCharacterMovementComponent::ClampVROffsetsForMove(FVector& InOutLFDiff, FVector& InOutCustomInput, float DeltaTime) const
+{
+	if (!bUseRelaxedMoveCombining)
+	{
+		return false;
+	}
+
+	// Clients never combine or send past this, anything larger didn't come from a valid move
+	const float MaxOffset = GetMaxVROffsetForMove(DeltaTime);
+	const float MaxOffsetSq = FMath::Square(MaxOffset);
+	bool bClamped = false;
+
+	if (InOutLFDiff.SizeSquared2D() > MaxOffsetSq)
+	{
+		UE_LOG(LogVRBaseCharacterMovement, Verbose, TEXT("Clamping HMD offset %s to %f"), *InOutLFDiff.ToCompactString(), MaxOffset);
+		InOutLFDiff = InOutLFDiff.GetClampedToMaxSize2D(MaxOffset);
+		bClamped = true;
+	}
+
+	if (InOutCustomInput.SizeSquared() > MaxOffsetSq)
+	{
+		UE_LOG(LogVRBaseCharacterMovement, Verbose, TEXT("Clamping custom input %s to %f"), *InOutCustomInput.ToCompactString(), MaxOffset);
+		InOutCustomInput = InOutCustomInput.GetClampedToMaxSize(MaxOffset);
+		bClamped = true;
+	}
+
+	return bClamped;
+}
+
+bool UVRBaseCharacterMovementComponent::CanMergeReplayMoves(const FSavedMovePtr& Move, const FSavedMovePtr& NextMove, float StepDeltaTime, const FVector& StepLFDiff, const FVector& StepCustomInput, float MaxStepDeltaTime) const
+{
+	if (StepDeltaTime + NextMove->DeltaTime > MaxStepDeltaTime)
+	{
+		return false;
+	}
+
+	// Move actions are only applied from the last move of the step
+	const FSavedMove_VRBaseCharacter* VRMove = static_cast<const FSavedMove_VRBaseCharacter*>(Move.Get());
+	if (VRMove->ConditionalValues.MoveActionArray.MoveActions.Num() > 0)
+	{
+		return false;
+	}
+
+	// The HMD offsets and custom inputs are summed over the step, keep the sums inside what a move of that length is clamped to
+	if (bUseRelaxedMoveCombining)
+	{
+		const FSavedMove_VRBaseCharacter* VRNextMove = static_cast<const FSavedMove_VRBaseCharacter*>(NextMove.Get());
+		const float MaxOffsetSq = FMath::Square(GetMaxVROffsetForMove(StepDeltaTime + NextMove->DeltaTime));
+
+		if ((StepCustomInput + VRNextMove->ConditionalValues.CustomVRInputVector).SizeSquared() > MaxOffsetSq)
+		{
+			return false;
+		}
+
+		if ((StepLFDiff + VRNextMove->LFDiff).SizeSquared2D() > MaxOffsetSq)
+		{
+			return false;
+		}
+	}
+
+	return Move->CanCombineWith(NextMove, CharacterOwner, MaxStepDeltaTime);
+}
+
+int32 UVRBaseCharacterMovementComponent::ReplaySavedMoveStep(FNetworkPredictionData_Client_Character& ClientData, int32 MoveIndex, bool bMergeReplay, float MaxReplayStepDelta)
+{
+	int32 LastMoveIndex = MoveIndex;
+	float StepDeltaTime = ClientData.SavedMoves[MoveIndex]->DeltaTime;
+	FVector StepLFDiff = FVector::ZeroVector;
+	FVector StepCustomInput = FVector::ZeroVector;
+	if (bMergeReplay)
+	{
+		const FSavedMove_VRBaseCharacter* FirstMove = static_cast<const FSavedMove_VRBaseCharacter*>(ClientData.SavedMoves[MoveIndex].Get());
+		StepLFDiff = FirstMove->LFDiff;
+		StepCustomInput = FirstMove->ConditionalValues.CustomVRInputVector;
+
+		// Summed the same way as CombineWith does, planar HMD offset with the newest Z
+		while (LastMoveIndex + 1 < ClientData.SavedMoves.Num() && CanMergeReplayMoves(ClientData.SavedMoves[LastMoveIndex], ClientData.SavedMoves[LastMoveIndex + 1], StepDeltaTime, StepLFDiff, StepCustomInput, MaxReplayStepDelta))
+		{
+			const FSavedMove_VRBaseCharacter* MergedMove = static_cast<const FSavedMove_VRBaseCharacter*>(ClientData.SavedMoves[++LastMoveIndex].Get());
+			StepDeltaTime += MergedMove->DeltaTime;
+			StepLFDiff = FVector(StepLFDiff.X + MergedMove->LFDiff.X, StepLFDiff.Y + MergedMove->LFDiff.Y, MergedMove->LFDiff.Z);
+			StepCustomInput += MergedMove->ConditionalValues.CustomVRInputVector;
+		}
+	}
+	const bool bMergedStep = LastMoveIndex > MoveIndex;
+
+	// The last move of the step carries its final HMD state and inputs
+	FSavedMove_Character* const CurrentMove = ClientData.SavedMoves[LastMoveIndex].Get();
+	checkSlow(CurrentMove != nullptr);
+
+	// Make current SavedMove accessible to any functions that might need it.
+	SetCurrentReplayedSavedMove(CurrentMove);
+
+	CurrentMove->PrepMoveFor(CharacterOwner);
+
+	// PrepMoveFor only applied the last moves offsets
+	if (bMergedStep)
+	{
+		ApplyMergedReplayOffsets(StepLFDiff, StepCustomInput);
+	}
+
+	if (ShouldUsePackedMovementRPCs())
+	{
+		// Make current move data accessible to MoveAutonomous or any other functions that might need it.
+		if (FCharacterNetworkMoveData* NewMove = GetNetworkMoveDataContainer().GetNewMoveData())
+		{
+			SetCurrentNetworkMoveData(NewMove);
+			NewMove->ClientFillNetworkMoveData(*CurrentMove, FCharacterNetworkMoveData::ENetworkMoveType::NewMove);
+
+			if (bMergedStep)
+			{
+				FVRCharacterNetworkMoveData* NewMoveVR = static_cast<FVRCharacterNetworkMoveData*>(NewMove);
+				NewMoveVR->LFDiff = StepLFDiff;
+				NewMoveVR->ConditionalMoveReps.CustomVRInputVector = StepCustomInput;
+			}
+		}
+	}
+
+	MoveAutonomous(CurrentMove->TimeStamp, StepDeltaTime, CurrentMove->GetCompressedFlags(), CurrentMove->Acceleration);
+
+	// Merged moves all end where the step did, PostUpdate would also copy the steps summed inputs into each of them
+	// so they keep their own, a later replay or an important move resend has to see what was originally recorded
+	for (int32 StepMoveIndex = MoveIndex; StepMoveIndex <= LastMoveIndex; ++StepMoveIndex)
+	{
+		FSavedMove_VRBaseCharacter* StepMove = static_cast<FSavedMove_VRBaseCharacter*>(ClientData.SavedMoves[StepMoveIndex].Get());
+		if (bMergedStep)
+		{
+			const FVRConditionalMoveRep OwnConditionalValues = StepMove->ConditionalValues;
+			StepMove->PostUpdate(CharacterOwner, FSavedMove_Character::PostUpdate_Replay);
+			StepMove->ConditionalValues = OwnConditionalValues;
+		}
+		else
+		{
+			StepMove->PostUpdate(CharacterOwner, FSavedMove_Character::PostUpdate_Replay);
+		}
+	}
+
+	SetCurrentNetworkMoveData(nullptr);
+	SetCurrentReplayedSavedMove(nullptr);
+
+	return LastMoveIndex;
+}
+
+void UVRBaseCharacterMovementComponent::ApplyMergedReplayOffsets(const FVector& StepLFDiff, const FVector& StepCustomInput)
+{
+	CustomVRInputVector = StepCustomInput;
+}
+
+bool UVRBaseCharacterMovementComponent::GetServerCorrectionReference(float TimeStamp, FVector& OutReference) const
+{
+	if (CorrectionReferenceTimeStamp < 0.f || CorrectionReferenceTimeStamp != TimeStamp)
+	{
+		return false;
+	}
+
+	OutReference = CorrectionReferenceLocation;
+	return true;
+}
+
+bool UVRBaseCharacterMovementComponent::GetClientCorrectionReference(float TimeStamp, FVector& OutReference, bool& bOutMoveFound) const
+{
+	bOutMoveFound = false;
+	if (!HasPredictionData_Client())
+	{
+		return false;
+	}
+
+	const FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+	const int32 MoveIndex = ClientData ? ClientData->GetSavedMoveIndex(TimeStamp) : INDEX_NONE;
+	if (MoveIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	bOutMoveFound = true;
+
+	// Has to be what the server received, not the saved location which replays overwrite
+	const FSavedMove_VRBaseCharacter* SavedMove = static_cast<const FSavedMove_VRBaseCharacter*>(ClientData->SavedMoves[MoveIndex].Get());
+	if (!SavedMove->bHasSentLocation)
+	{
+		return false;
+	}
+
+	// The raw values are the reference whatever space they were sent in, so the base never has to be resolved for it
+	OutReference = SavedMove->SentLocation;
+	return true;
+}
+
+void UVRBaseCharacterMovementComponent::ServerMove_HandleMoveData(const FCharacterNetworkMoveDataContainer& MoveDataContainer)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VRCharacterMovementServerHandleMoveData);
+
+	if (!VRCharacterMovementBench::IsRecording())
+	{
+		Super::ServerMove_HandleMoveData(MoveDataContainer);
+		return;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Super::ServerMove_HandleMoveData(MoveDataContainer);
+
+	const int32 NumMoves = 1 + (MoveDataContainer.bHasPendingMove ? 1 : 0) + (MoveDataContainer.bHasOldMove ? 1 : 0);
+	VRCharacterMovementBench::AddServerMoveTime(static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles)), NumMoves);
+}
+
+void UVRBaseCharacterMovementComponent::ServerMovePacked_ServerReceive(const FCharacterServerMovePackedBits& PackedBits)
+{
+	VRCharacterMovementBench::AddCount(VRCharacterMovementBench::ECounter::ServerPacketBits, PackedBits.DataBits.Num());
+	Super::ServerMovePacked_ServerReceive(PackedBits);
+}
+
 void UVRBaseCharacterMovementComponent::CheckServerAuthedMoveAction()
 {
 	// If we are calling this on the server on a non owned character, there is no reason to wait around, just do the action now
@@ -1636,6 +1933,31 @@ void UVRBaseCharacterMovementComponent::OnClientCorrectionReceived(class FNetwor
 	}
 }
 
+float UVRBaseCharacterMovementComponent::GetClosestLocalViewDistanceSquared() const
+{
+	float ClosestDistSq = UE_BIG_NUMBER;
+
+	UWorld* World = GetWorld();
+	if (!World || !UpdatedComponent)
+	{
+		return ClosestDistSq;
+	}
+
+	const FVector CharLocation = UpdatedComponent->GetComponentLocation();
+
+	// Can be more than one local player with split screen
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PC = Iterator->Get();
+		if (PC && PC->IsLocalController() && PC->PlayerCameraManager)
+		{
+			ClosestDistSq = FMath::Min(ClosestDistSq, (float)FVector::DistSquared(PC->PlayerCameraManager->GetCameraLocation(), CharLocation));
+		}
+	}
+
+	return ClosestDistSq;
+}
+
 void UVRBaseCharacterMovementComponent::SimulatedTick(float DeltaSeconds)
 {
 	//return Super::SimulatedTick(DeltaSeconds);
@@ -1643,6 +1965,37 @@ void UVRBaseCharacterMovementComponent::SimulatedTick(float DeltaSeconds)
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_Character_CharacterMovementSimulated);
 	checkSlow(CharacterOwner != nullptr);
 
+	bSimulatedProxyIsFar = false;
+	bSimulatedProxyLODSkippedFrame = false;
+
+	// Distance is also used to cull the repulsion force of root motion proxies
+	SimulatedProxyViewDistanceSq = bUseSimulatedProxyLOD ? GetClosestLocalViewDistanceSquared() : 0.0f;
+
+	// Root motion needs every frame, otherwise far proxies only interpolate and at a reduced rate
+	// Distance only, a nearby proxy that is out of view (behind the player) can still be walked into or turned towards
+	if (bUseSimulatedProxyLOD && UpdatedComponent && !CharacterOwner->IsPlayingNetworkedRootMotionMontage() && !CurrentRootMotion.HasActiveRootMotionSources())
+	{
+		bSimulatedProxyIsFar = SimulatedProxyViewDistanceSq > FMath::Square(SimulatedProxyLODDistance);
+
+		if (bSimulatedProxyIsFar && SimulatedProxyLODUpdateRate > 0.0f)
+		{
+			SimulatedProxyLODAccumulatedTime += DeltaSeconds;
+			if (SimulatedProxyLODAccumulatedTime < 1.0f / SimulatedProxyLODUpdateRate)
+			{
+				bSimulatedProxyLODSkippedFrame = true;
+				return;
+			}
+
+			DeltaSeconds = SimulatedProxyLODAccumulatedTime;
+		}
+
+		SimulatedProxyLODAccumulatedTime = 0.0f;
+	}
+	else
+	{
+		SimulatedProxyLODAccumulatedTime = 0.0f;
+	}
+
 	// If we are playing a RootMotion AnimMontage.
 	if (CharacterOwner->IsPlayingNetworkedRootMotionMontage())
 	{
@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VRCharacterMovementBench.h"
+#include "VRBaseCharacterMovementComponent.h"
+#include "Misc/VRSampleReservoir.h"
+
+namespace VRCharacterMovementBench
+{
+	// Samples kept for the percentiles, the move count keeps going past this
+	static const int32 MaxSamples = 65536;
+
+	static bool bRecording = false;
+	static uint64 Counters[(uint8)ECounter::Max] = { 0 };
+	static FVRSampleReservoir ServerMoveMilliseconds(MaxSamples);
+	static double StartTime = 0.0;
+
+	bool IsRecording()
+	{
+		return bRecording;
+	}
+
+	void AddCount(ECounter Counter, uint64 Amount)
+	{
+		if (bRecording)
+		{
+			Counters[(uint8)Counter] += Amount;
+		}
+	}
+
+	void AddServerMoveTime(float Milliseconds, int32 NumMoves)
+	{
+		if (bRecording && NumMoves > 0)
+		{
+			// Moves in a packet are simulated back to back, spread the cost across them
+			const float PerMove = Milliseconds / NumMoves;
+			for (int32 i = 0; i < NumMoves; ++i)
+			{
+				ServerMoveMilliseconds.Add(PerMove);
+			}
+			Counters[(uint8)ECounter::ServerMoves] += NumMoves;
+		}
+	}
+
+	uint64 GetCount(ECounter Counter)
+	{
+		return Counters[(uint8)Counter];
+	}
+
+	void StartRecording()
+	{
+		FMemory::Memzero(Counters);
+		ServerMoveMilliseconds.Reset();
+		StartTime = FPlatformTime::Seconds();
+		bRecording = true;
+	}
+
+	void StopRecording(bool bLogReport)
+	{
+		bRecording = false;
+		const TArray<float> Samples = ServerMoveMilliseconds.ConsumeSorted();
+
+		if (!bLogReport)
+		{
+			return;
+		}
+
+		const double Duration = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+		const uint64 NumMoves = Counters[(uint8)ECounter::ServerMoves];
+
+		UE_LOG(LogVRBaseCharacterMovement, Log, TEXT("VRCharacterMovement Bench: duration=%.2fs server moves=%llu (%.1f per second)"), Duration, NumMoves, NumMoves / Duration);
+		UE_LOG(LogVRBaseCharacterMovement, Log, TEXT("VRCharacterMovement Bench: ServerMsPerMove p50=%.4f p95=%.4f p99=%.4f max=%.4f"),
+			FVRSampleReservoir::GetPercentile(Samples, 0.5f), FVRSampleReservoir::GetPercentile(Samples, 0.95f), FVRSampleReservoir::GetPercentile(Samples, 0.99f), Samples.Num() ? Samples.Last() : 0.0f);
+		UE_LOG(LogVRBaseCharacterMovement, Log, TEXT("VRCharacterMovement Bench: BytesPerMove=%.2f CorrectionsSent=%llu CorrectionsReceived=%llu"),
+			NumMoves ? (Counters[(uint8)ECounter::ServerPacketBits] / 8.0) / NumMoves : 0.0, Counters[(uint8)ECounter::CorrectionsSent], Counters[(uint8)ECounter::CorrectionsReceived]);
+		UE_LOG(LogVRBaseCharacterMovement, Log, TEXT("VRCharacterMovement Bench: FloorQueries=%llu FloorCacheHits=%llu RootSweeps=%llu"),
+			Counters[(uint8)ECounter::FloorQueries], Counters[(uint8)ECounter::FloorCacheHits], Counters[(uint8)ECounter::RootSweeps]);
+	}
+
+#if !UE_BUILD_SHIPPING
+	static FAutoConsoleCommand BenchStartCommand(
+		TEXT("vrexp.CharacterMovement.BenchStart"),
+		TEXT("Start recording VR character movement cost (server ms per move, bytes per move, corrections, floor queries, root sweeps) for vrexp.CharacterMovement.BenchReport.\n")
+		TEXT("Combine with the NetEmulation.* settings to measure under latency and packet loss, VRExpansionPlugin.CharacterMovement.Bench runs a scripted load in an automation test."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			StartRecording();
+		}));
+
+	static FAutoConsoleCommand BenchReportCommand(
+		TEXT("vrexp.CharacterMovement.BenchReport"),
+		TEXT("Stop recording and log the VR character movement benchmark results."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			if (!bRecording)
+			{
+				UE_LOG(LogVRBaseCharacterMovement, Warning, TEXT("VRCharacterMovement Bench: not recording, run vrexp.CharacterMovement.BenchStart first"));
+				return;
+			}
+
+			StopRecording(true);
+		}));
+#endif // !UE_BUILD_SHIPPING
+}
@@ -0,0 +1,35 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Movement cost measurement that works in headless (-nullrhi) sessions
+// vrexp.CharacterMovement.BenchStart begins recording, vrexp.CharacterMovement.BenchReport logs the results since then (not in shipping builds)
+// Everything here is game thread only
+namespace VRCharacterMovementBench
+{
+	enum class ECounter : uint8
+	{
+		ServerMoves,
+		ServerPacketBits,
+		CorrectionsSent,
+		CorrectionsReceived,
+		FloorQueries,
+		FloorCacheHits,
+		RootSweeps,
+		Max
+	};
+
+	bool IsRecording();
+	void AddCount(ECounter Counter, uint64 Amount = 1);
+	void AddServerMoveTime(float Milliseconds, int32 NumMoves);
+
+	// Resets the counters and samples and begins recording
+	void StartRecording();
+
+	// Ends recording, logging the results when bLogReport is set
+	void StopRecording(bool bLogReport);
+
+	uint64 GetCount(ECounter Counter);
+}
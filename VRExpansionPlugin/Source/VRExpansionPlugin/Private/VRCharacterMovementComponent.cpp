@@ -36,6 +36,7 @@
 #include "Runtime/Launch/Resources/Version.h"
 #include "GameFramework/CharacterMovementReplication.h"
 #include "Interfaces/NetworkPredictionInterface.h"
+#include "VRCharacterMovementBench.h"
 
 //#include "PerfCountersHelpers.h"
 
@@ -93,6 +94,14 @@ namespace CharacterMovementComponentStatics
 		TEXT("Error threshold value before correcting a clients rotation when actively changing rotation.\n")
 		TEXT("Rotation is replicated at 2 decimal precision, so values less than 0.01 won't matter."),
 		ECVF_Default);
+
+	static int32 bUseCachedBaseTransformForClientError = 1;
+	FAutoConsoleVariableRef CVarUseCachedBaseTransformForClientError(
+		TEXT("vre.UseCachedBaseTransformForClientError"),
+		bUseCachedBaseTransformForClientError,
+		TEXT("When the client and server share a movement base, resolve the clients base relative location with the base transform saved at the end of the move instead of looking it up again.\n")
+		TEXT("0: Always look up the base transform, 1: Enable"),
+		ECVF_Default);
 }
 
 void UVRCharacterMovementComponent::StoreSetTrackingPaused(bool bNewTrackingPaused)
@@ -472,6 +481,17 @@ void FSavedMove_VRCharacter::PrepMoveFor(ACharacter* Character)
 }
 
 
+void UVRCharacterMovementComponent::ApplyMergedReplayOffsets(const FVector& StepLFDiff, const FVector& StepCustomInput)
+{
+	Super::ApplyMergedReplayOffsets(StepLFDiff, StepCustomInput);
+
+	if (VRRootCapsule)
+	{
+		VRRootCapsule->DifferenceFromLastFrame = StepLFDiff;
+		AdditionalVRInputVector = StepLFDiff;
+	}
+}
+
 void UVRCharacterMovementComponent::RegenerateOffset()
 {
 	if(VRRootCapsule)
@@ -604,7 +624,9 @@ void UVRCharacterMovementComponent::ServerMove_PerformMovement(const FCharacterN
 				bHasRequestedVelocity = true;
 			}
 
+			FVector ReceivedLFDiff = MoveDataVR->LFDiff;
 			CustomVRInputVector = MoveDataVR->ConditionalMoveReps.CustomVRInputVector;
+			ClampVROffsetsForMove(ReceivedLFDiff, CustomVRInputVector, DeltaTime);
 			MoveActionArray = MoveDataVR->ConditionalMoveReps.MoveActionArray;
 			VRReplicatedMovementMode = MoveDataVR->ReplicatedMovementMode;
 
@@ -614,7 +636,7 @@ void UVRCharacterMovementComponent::ServerMove_PerformMovement(const FCharacterN
 			{
 				VRRootCapsule->curCameraLoc = MoveDataVR->VRCapsuleLocation;
 				VRRootCapsule->curCameraRot = FRotator(0.0f, FRotator::DecompressAxisFromShort(MoveDataVR->VRCapsuleRotation), 0.0f);
-				VRRootCapsule->DifferenceFromLastFrame = MoveDataVR->LFDiff;//FVector(MoveDataVR->LFDiff.X, MoveDataVR->LFDiff.Y, 0.0f);
+				VRRootCapsule->DifferenceFromLastFrame = ReceivedLFDiff;//FVector(MoveDataVR->LFDiff.X, MoveDataVR->LFDiff.Y, 0.0f);
 				AdditionalVRInputVector = VRRootCapsule->DifferenceFromLastFrame;
 
 				if (BaseVRCharacterOwner)
@@ -1324,6 +1346,21 @@ void UVRCharacterMovementComponent::ReplicateMoveToServer(float DeltaTime, const
 	Acceleration = NewMove->Acceleration.GetClampedToMaxSize(GetMaxAcceleration());
 	AnalogInputModifier = ComputeAnalogInputModifier(); // recompute since acceleration may have changed.
 
+	// Apply the same offset clamp that the server runs on this move so that both sides simulate it identically
+	{
+		FSavedMove_VRBaseCharacter* BaseNewMove = (FSavedMove_VRBaseCharacter*)NewMove;
+		if (ClampVROffsetsForMove(BaseNewMove->LFDiff, BaseNewMove->ConditionalValues.CustomVRInputVector, NewMove->DeltaTime))
+		{
+			CustomVRInputVector = BaseNewMove->ConditionalValues.CustomVRInputVector;
+			AdditionalVRInputVector = BaseNewMove->LFDiff;
+
+			if (VRRootCapsule)
+			{
+				VRRootCapsule->DifferenceFromLastFrame = BaseNewMove->LFDiff;
+			}
+		}
+	}
+
 	// Perform the move locally
 	CharacterOwner->ClientRootMotionParams.Clear();
 	CharacterOwner->SavedRootMotion.Clear();
@@ -1478,6 +1515,13 @@ bool UVRCharacterMovementComponent::CanCrouch()
 
 void UVRCharacterMovementComponent::ApplyRepulsionForce(float DeltaSeconds)
 {
+	// Far remote proxies don't push anything around locally
+	if (bUseSimulatedProxyLOD && CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_SimulatedProxy &&
+		SimulatedProxyViewDistanceSq > FMath::Square(SimulatedProxyRepulsionDistance))
+	{
+		return;
+	}
+
 	if (UpdatedPrimitive && RepulsionForce > 0.0f && CharacterOwner != nullptr)
 	{
 		const TArray<FOverlapInfo>& Overlaps = UpdatedPrimitive->GetOverlapInfos();
@@ -2446,6 +2490,12 @@ void UVRCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FF
 
 		if (bAlwaysCheckFloor || !bCanUseCachedLocation || bForceNextFloorCheck || bJustTeleported)
 		{
+			// A forced check needs fresh traces, not the per frame floor cache
+			if (bForceNextFloorCheck || bJustTeleported)
+			{
+				InvalidateFloorCache();
+			}
+
 			MutableThis->bForceNextFloorCheck = false;
 			ComputeFloorDist(UseCapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
 		}
@@ -3717,13 +3767,14 @@ void UVRCharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 			FStepDownResult StepDownResult;
 
 			// Skip the estimated movement when movement simulation is off, but keep the floor find
-			if(!bDisableSimulatedTickWhenSmoothingMovement)
+			// Far LOD proxies skip both and only interpolate toward the replicated location
+			if(!bDisableSimulatedTickWhenSmoothingMovement && !bSimulatedProxyIsFar)
 			{ 
 				MoveSmooth(Velocity, DeltaSeconds, &StepDownResult);
 			}
 
 			// find floor and check if falling
-			if (IsMovingOnGround() || MovementMode == MOVE_Falling)
+			if (!bSimulatedProxyIsFar && (IsMovingOnGround() || MovementMode == MOVE_Falling))
 			{
 				bool bShouldFindFloor = Velocity.Z <= 0.f;
 				if (HasCustomGravity())
@@ -3934,6 +3985,8 @@ void UVRCharacterMovementComponent::ClientHandleMoveResponse(const FCharacterMov
 	}
 	else
 	{
+		VRCharacterMovementBench::AddCount(VRCharacterMovementBench::ECounter::CorrectionsReceived);
+
 		// Wrappers to old RPC handlers, to maintain compatibility. If overrides need additional serialized data, they can access GetMoveResponseDataContainer()
 		if (MoveResponse.bRootMotionSourceCorrection)
 		{
@@ -4339,11 +4392,89 @@ void UVRCharacterMovementComponent::ServerMoveHandleClientErrorVR(float ClientTi
 		}
 	}
 
+	// Takes the clients location, mode and base over ours
+	auto AcceptClientPosition = [&](const FVector& ClientLoc)
+	{
+		const FVector LocDiff = UpdatedComponent->GetComponentLocation() - ClientLoc; //-V595
+		if (!LocDiff.IsZero() || ClientMovementMode != PackNetworkMovementMode() || GetMovementBase() != ClientMovementBase || (CharacterOwner && CharacterOwner->GetBasedMovement().BoneName != ClientBaseBoneName))
+		{
+			// Just set the position. On subsequent moves we will resolve initially overlapping conditions.
+			UpdatedComponent->SetWorldLocation(ClientLoc, false); //-V595
+
+			// Trust the client's movement mode.
+			ApplyNetworkMovementMode(ClientMovementMode);
+
+			// Update base and floor at new location.
+			SetBase(ClientMovementBase, ClientBaseBoneName);
+			UpdateFloorFromAdjustment();
+
+			// Even if base has not changed, we need to recompute the relative offsets (since we've moved).
+			SaveBaseLocation();
+
+			LastUpdateLocation = UpdatedComponent ? UpdatedComponent->GetComponentLocation() : FVector::ZeroVector;
+			LastUpdateRotation = UpdatedComponent ? UpdatedComponent->GetComponentQuat() : FQuat::Identity;
+			LastUpdateVelocity = Velocity;
+		}
+
+		// acknowledge receipt of this successful servermove()
+		ServerData->PendingAdjustment.TimeStamp = ClientTimeStamp;
+		ServerData->PendingAdjustment.bAckGoodMove = true;
+	};
+
+	// Custom movement modes aren't going to be rolled back as they are client authed for our pawns
+	TEnumAsByte<EMovementMode> NetMovementMode(MOVE_None);
+	TEnumAsByte<EMovementMode> NetGroundMode(MOVE_None);
+	uint8 NetCustomMode(0);
+	UnpackNetworkMovementMode(ClientMovementMode, NetMovementMode, NetCustomMode, NetGroundMode);
+	if (NetMovementMode == EMovementMode::MOVE_Custom && NetCustomMode == (uint8)EVRCustomMovementMode::VRMOVE_Climbing)
+	{
+		// The clients position is taken as is, so none of the error, leash or landing handling below applies.
+		// Only its world location is needed, and only to apply it.
+		FVector ClientLoc = RelativeClientLoc;
+		if (MovementBaseUtility::UseRelativeLocation(ClientMovementBase))
+		{
+			MovementBaseUtility::TransformLocationToWorld(ClientMovementBase, ClientBaseBoneName, RelativeClientLoc, ClientLoc);
+		}
+		else
+		{
+			ClientLoc = FRepMovement::RebaseOntoLocalOrigin(ClientLoc, this);
+		}
+
+		UPrimitiveComponent* MovementBase = CharacterOwner->GetMovementBase();
+		const FName MovementBaseBoneName = CharacterOwner->GetBasedMovement().BoneName;
+		const bool bServerIsFalling = IsFalling();
+
+		AcceptClientPosition(ClientLoc);
+
+		MaxServerClientErrorWhileFalling = 0.f;
+		bCanTrustClientOnLanding = false;
+		ServerData->bForceClientUpdate = false;
+
+		LastServerMovementBaseVR = MovementBase;
+		LastServerMovementBaseBoneName = MovementBaseBoneName;
+		bLastClientIsFalling = false;
+		bLastServerIsFalling = bServerIsFalling;
+		bLastServerIsWalking = MovementMode == MOVE_Walking;
+		return;
+	}
+
 	// Offset may be relative to base component
 	FVector ClientLoc = RelativeClientLoc;
-	if (MovementBaseUtility::UseRelativeLocation(ClientMovementBase))
+	const bool bClientLocIsRelative = MovementBaseUtility::UseRelativeLocation(ClientMovementBase);
+	const UPrimitiveComponent* ClientLocBase = ClientMovementBase;
+	const FName ClientLocBoneName = ClientBaseBoneName;
+	if (bClientLocIsRelative)
 	{
-		MovementBaseUtility::TransformLocationToWorld(ClientMovementBase, ClientBaseBoneName, RelativeClientLoc, ClientLoc);
+		// Same base as the server, its transform was saved at the end of this move so we don't need to look it up (and the bone) again
+		if (CharacterMovementComponentStatics::bUseCachedBaseTransformForClientError && !bDeferUpdateBasedMovement &&
+			ClientMovementBase == CharacterOwner->GetMovementBase() && ClientBaseBoneName == CharacterOwner->GetBasedMovement().BoneName)
+		{
+			ClientLoc = FTransform(OldBaseQuat, OldBaseLocation).TransformPositionNoScale(RelativeClientLoc);
+		}
+		else
+		{
+			MovementBaseUtility::TransformLocationToWorld(ClientMovementBase, ClientBaseBoneName, RelativeClientLoc, ClientLoc);
+		}
 	}
 	else
 	{
@@ -4354,17 +4485,10 @@ void UVRCharacterMovementComponent::ServerMoveHandleClientErrorVR(float ClientTi
 
 	// Client may send a null movement base when walking on bases with no relative location (to save bandwidth).
 	// In this case don't check movement base in error conditions, use the server one (which avoids an error based on differing bases). Position will still be validated.
-	if (ClientMovementBase == nullptr)
+	if (ClientMovementBase == nullptr && NetMovementMode == MOVE_Walking)
 	{
-		TEnumAsByte<EMovementMode> NetMovementMode(MOVE_None);
-		TEnumAsByte<EMovementMode> NetGroundMode(MOVE_None);
-		uint8 NetCustomMode(0);
-		UnpackNetworkMovementMode(ClientMovementMode, NetMovementMode, NetCustomMode, NetGroundMode);
-		if (NetMovementMode == MOVE_Walking)
-		{
-			ClientMovementBase = CharacterOwner->GetBasedMovement().MovementBase;
-			ClientBaseBoneName = CharacterOwner->GetBasedMovement().BoneName;
-		}
+		ClientMovementBase = CharacterOwner->GetBasedMovement().MovementBase;
+		ClientBaseBoneName = CharacterOwner->GetBasedMovement().BoneName;
 	}
 
 	// If base location is out of sync on server and client, changing base can result in a jarring correction.
@@ -4527,24 +4651,31 @@ void UVRCharacterMovementComponent::ServerMoveHandleClientErrorVR(float ClientTi
 		}
 	}
 
-	bool bInClientAuthoritativeMovementMode = false;
-	// Custom movement modes aren't going to be rolled back as they are client authed for our pawns
+	// Compute the client error from the server's position
+	// If client has accumulated a noticeable positional error, correct them.
+	bNetworkLargeClientCorrection = ServerData->bForceClientUpdate;
+	const bool bNeedsCorrection = ServerData->bForceClientUpdate || (!bFallingWithinAcceptableError && ServerCheckClientErrorVR(ClientTimeStamp, DeltaTime, Accel, ClientLoc, ClientRot, RelativeClientLoc, ClientMovementBase, ClientBaseBoneName, ClientMovementMode));
 
-	TEnumAsByte<EMovementMode> NetMovementMode(MOVE_None);
-	TEnumAsByte<EMovementMode> NetGroundMode(MOVE_None);
-	uint8 NetCustomMode(0);
-	UnpackNetworkMovementMode(ClientMovementMode, NetMovementMode, NetCustomMode, NetGroundMode);
-	if (NetMovementMode == EMovementMode::MOVE_Custom)
+	// Coalesce corrections, a held back one leaves the move un-acked the same as the update delay bounds above
+	bool bHoldBackCorrection = false;
+	if (bNeedsCorrection && !ServerData->bForceClientUpdate && MinTimeBetweenClientCorrections > 0.f)
 	{
-		if (NetCustomMode == (uint8)EVRCustomMovementMode::VRMOVE_Climbing)
-			bInClientAuthoritativeMovementMode = true;
+		const float CorrectionError = FVector::Dist(UpdatedComponent->GetComponentLocation(), ClientLoc);
+		if ((GetWorld()->TimeSeconds - LastClientCorrectionTime) < MinTimeBetweenClientCorrections && CorrectionError <= LastClientCorrectionError * ClientCorrectionErrorGrowthFactor)
+		{
+			bHoldBackCorrection = true;
+		}
+		else
+		{
+			LastClientCorrectionTime = GetWorld()->TimeSeconds;
+			LastClientCorrectionError = CorrectionError;
+		}
 	}
 
-	// Compute the client error from the server's position
-	// If client has accumulated a noticeable positional error, correct them.
-	bNetworkLargeClientCorrection = ServerData->bForceClientUpdate;
-	if (!bInClientAuthoritativeMovementMode && (ServerData->bForceClientUpdate || (!bFallingWithinAcceptableError && ServerCheckClientErrorVR(ClientTimeStamp, DeltaTime, Accel, ClientLoc, ClientRot, RelativeClientLoc, ClientMovementBase, ClientBaseBoneName, ClientMovementMode))))
+	if (bNeedsCorrection && !bHoldBackCorrection)
 	{
+		VRCharacterMovementBench::AddCount(VRCharacterMovementBench::ECounter::CorrectionsSent);
+
 		//UPrimitiveComponent* MovementBase = CharacterOwner->GetMovementBase();
 		ServerData->PendingAdjustment.NewVel = Velocity;
 		ServerData->PendingAdjustment.NewBase = MovementBase;
@@ -4644,41 +4775,32 @@ void UVRCharacterMovementComponent::ServerMoveHandleClientErrorVR(float ClientTi
 		ServerData->PendingAdjustment.bAckGoodMove = false;
 		ServerData->PendingAdjustment.MovementMode = PackNetworkMovementMode();
 
+		// The clients reported location only saves bits as a compact correction reference if the correction is in the same space
+		const bool bSameLocationSpace = ServerData->PendingAdjustment.bBaseRelativePosition ?
+			(bClientLocIsRelative && ServerData->PendingAdjustment.NewBase == ClientLocBase && ServerData->PendingAdjustment.NewBaseBoneName == ClientLocBoneName) :
+			!bClientLocIsRelative;
+
+		SetClientCorrectionReference(bSameLocationSpace ? ClientTimeStamp : -1.f, RelativeClientLoc);
+
 		//PerfCountersIncrement(PerfCounter_NumServerMoveCorrections);
 	}
-	else
+	else if (!bNeedsCorrection)
 	{
-		if (bInClientAuthoritativeMovementMode || ServerShouldUseAuthoritativePosition(ClientTimeStamp, DeltaTime, Accel, ClientLoc, RelativeClientLoc, ClientMovementBase, ClientBaseBoneName, ClientMovementMode))
+		if (ServerShouldUseAuthoritativePosition(ClientTimeStamp, DeltaTime, Accel, ClientLoc, RelativeClientLoc, ClientMovementBase, ClientBaseBoneName, ClientMovementMode))
 		{
-			const FVector LocDiff = UpdatedComponent->GetComponentLocation() - ClientLoc; //-V595
-			if (!LocDiff.IsZero() || ClientMovementMode != PackNetworkMovementMode() || GetMovementBase() != ClientMovementBase || (CharacterOwner && CharacterOwner->GetBasedMovement().BoneName != ClientBaseBoneName))
-			{
-				// Just set the position. On subsequent moves we will resolve initially overlapping conditions.
-				UpdatedComponent->SetWorldLocation(ClientLoc, false); //-V595
-
-																	  // Trust the client's movement mode.
-				ApplyNetworkMovementMode(ClientMovementMode);
-
-				// Update base and floor at new location.
-				SetBase(ClientMovementBase, ClientBaseBoneName);
-				UpdateFloorFromAdjustment();
-
-				// Even if base has not changed, we need to recompute the relative offsets (since we've moved).
-				SaveBaseLocation();
-
-				LastUpdateLocation = UpdatedComponent ? UpdatedComponent->GetComponentLocation() : FVector::ZeroVector;
-				LastUpdateRotation = UpdatedComponent ? UpdatedComponent->GetComponentQuat() : FQuat::Identity;
-				LastUpdateVelocity = Velocity;
-			}
+			AcceptClientPosition(ClientLoc);
+		}
+		else
+		{
+			// acknowledge receipt of this successful servermove()
+			ServerData->PendingAdjustment.TimeStamp = ClientTimeStamp;
+			ServerData->PendingAdjustment.bAckGoodMove = true;
 		}
-
-		// acknowledge receipt of this successful servermove()
-		ServerData->PendingAdjustment.TimeStamp = ClientTimeStamp;
-		ServerData->PendingAdjustment.bAckGoodMove = true;
 	}
 
 	//PerfCountersIncrement(PerfCounter_NumServerMoves);
 
+	// A held back correction still runs this, the falling / landing state has to track every move
 	ServerData->bForceClientUpdate = false;
 
 	LastServerMovementBaseVR = MovementBase;
@@ -4760,33 +4882,15 @@ bool UVRCharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
 	FVector Orig_AdditionalVRInputVector = AdditionalVRInputVector;
 	FRotator Orig_CameraRotOffset = VRRootCapsule->StoredCameraRotOffset;
 
+	// Past the threshold contiguous compatible moves are replayed as a single step
+	const bool bMergeReplay = bMergeReplayMoves && ClientData->SavedMoves.Num() > ReplayMergeMoveThreshold;
+	const float MaxReplayStepDelta = ClientData->MaxMoveDeltaTime * CharacterOwner->GetActorTimeDilation();
+
 	// Replay moves that have not yet been acked.
 	UE_LOG(LogNetPlayerMovement, Verbose, TEXT("ClientUpdatePositionAfterServerUpdate Replaying %d Moves, starting at Timestamp %f"), ClientData->SavedMoves.Num(), ClientData->SavedMoves[0]->TimeStamp);
 	for (int32 i = 0; i < ClientData->SavedMoves.Num(); i++)
 	{
-		FSavedMove_Character* const CurrentMove = ClientData->SavedMoves[i].Get();
-		checkSlow(CurrentMove != nullptr);
-
-		// Make current SavedMove accessible to any functions that might need it.PrepMoveFor
-		SetCurrentReplayedSavedMove(CurrentMove);
-
-		CurrentMove->PrepMoveFor(CharacterOwner);
-
-		if (ShouldUsePackedMovementRPCs())
-		{
-			// Make current move data accessible to MoveAutonomous or any other functions that might need it.
-			if (FCharacterNetworkMoveData* NewMove = GetNetworkMoveDataContainer().GetNewMoveData())
-			{
-				SetCurrentNetworkMoveData(NewMove);
-				NewMove->ClientFillNetworkMoveData(*CurrentMove, FCharacterNetworkMoveData::ENetworkMoveType::NewMove);
-			}
-		}
-
-		MoveAutonomous(CurrentMove->TimeStamp, CurrentMove->DeltaTime, CurrentMove->GetCompressedFlags(), CurrentMove->Acceleration);
-
-		CurrentMove->PostUpdate(CharacterOwner, FSavedMove_Character::PostUpdate_Replay);
-		SetCurrentNetworkMoveData(nullptr);
-		SetCurrentReplayedSavedMove(nullptr);
+		i = ReplaySavedMoveStep(*ClientData, i, bMergeReplay, MaxReplayStepDelta);
 	}
 	const bool bPostReplayPressedJump = CharacterOwner->bPressedJump;
 
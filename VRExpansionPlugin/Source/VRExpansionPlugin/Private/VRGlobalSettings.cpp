@@ -32,6 +32,8 @@ UVRGlobalSettings::UVRGlobalSettings(const FObjectInitializer& ObjectInitializer
 		bUseCollisionModificationForCollisionIgnore = false;
 		CollisionIgnoreSubsystemUpdateRate = 1.f;
 
+		bBatchServerTrackedPoseUpdates = false;
+
 		bUseChaosTranslationScalers = false;
 		bSetEngineChaosScalers = false;
 		LinearDriveStiffnessScale = 1.0f;// Chaos::ConstraintSettings::LinearDriveStiffnessScale();
@@ -50,6 +52,24 @@ UVRGlobalSettings::UVRGlobalSettings(const FObjectInitializer& ObjectInitializer
 
 }
 
+float FVRPhysicsReplicationCorrectionProfile::GetErrorScale(float NearestViewerDistance, float BoundsRadius) const
+{
+	if (!bUseAdaptiveErrorThresholds)
+	{
+		return 1.0f;
+	}
+
+	const float DistanceAlpha = FarViewerDistance > NearViewerDistance ?
+		FMath::Clamp((NearestViewerDistance - NearViewerDistance) / (FarViewerDistance - NearViewerDistance), 0.0f, 1.0f) :
+		(NearestViewerDistance > NearViewerDistance ? 1.0f : 0.0f);
+	const float DistanceScale = FMath::Lerp(1.0f, FarErrorScale, DistanceAlpha);
+
+	const float SizeScale = (BoundsRadius > UE_KINDA_SMALL_NUMBER && ReferenceRadius > 0.0f) ?
+		FMath::Clamp(ReferenceRadius / BoundsRadius, 1.0f, MaxSizeErrorScale) : 1.0f;
+
+	return DistanceScale * SizeScale;
+}
+
 TSubclassOf<class UGrippableSkeletalMeshComponent> UVRGlobalSettings::GetDefaultGrippableCharacterMeshComponentClass()
 {
 	const UVRGlobalSettings* VRSettings = GetDefault<UVRGlobalSettings>();
@@ -0,0 +1,125 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+
+// Residual encoders for the VR character move and response containers, the receiving end always
+// decodes against the same reference value that the sender encoded against.
+namespace VRMoveDeltaEncoding
+{
+	inline uint32 ZigZag(int32 Value)
+	{
+		return ((uint32)Value << 1) ^ (uint32)(Value >> 31);
+	}
+
+	inline int32 UnZigZag(uint32 Value)
+	{
+		return (int32)(Value >> 1) ^ -(int32)(Value & 1);
+	}
+
+	inline uint32 FloatToBits(float Value)
+	{
+		uint32 Bits = 0;
+		FMemory::Memcpy(&Bits, &Value, sizeof(float));
+		return Bits;
+	}
+
+	inline float BitsToFloat(uint32 Bits)
+	{
+		float Value = 0.f;
+		FMemory::Memcpy(&Value, &Bits, sizeof(float));
+		return Value;
+	}
+
+	// Lossless, sent as the distance in float steps to the newer reference stamp. The client acks moves by exact timestamp.
+	inline void SerializeTimeStamp(FArchive& Ar, float& TimeStamp, float ReferenceTimeStamp)
+	{
+		const uint32 ReferenceBits = FloatToBits(ReferenceTimeStamp);
+		uint8 bInRange = 0;
+		uint32 StepDelta = 0;
+
+		if (Ar.IsSaving())
+		{
+			// Positive floats order the same as their bit patterns, fall back if the timestamp was reset between the moves
+			const uint32 Bits = FloatToBits(TimeStamp);
+			bInRange = TimeStamp >= 0.f && ReferenceTimeStamp >= 0.f && ReferenceBits >= Bits && (ReferenceBits - Bits) < (1u << 24);
+			StepDelta = bInRange ? ReferenceBits - Bits : 0;
+		}
+
+		Ar.SerializeBits(&bInRange, 1);
+
+		if (bInRange)
+		{
+			Ar.SerializeIntPacked(StepDelta);
+
+			if (Ar.IsLoading())
+			{
+				TimeStamp = BitsToFloat(ReferenceBits - StepDelta);
+			}
+		}
+		else
+		{
+			Ar << TimeStamp;
+		}
+	}
+
+	// Per component residual at the same precision as FVector_NetQuantize<Scale>, against the reference as the receiving end decoded it
+	// 2 bit mode: 0 = same as reference, 1 = residuals, 2 = out of range, full packed vector
+	template<int32 Scale, int32 MaxBitsPerComponent>
+	inline bool SerializeVectorResidual(FArchive& Ar, FVector& Value, const FVector& Reference)
+	{
+		int64 Residuals[3] = { 0, 0, 0 };
+		uint8 Mode = 0;
+
+		if (Ar.IsSaving())
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				Residuals[Axis] = FMath::RoundToInt64(Value[Axis] * Scale) - FMath::RoundToInt64(Reference[Axis] * Scale);
+
+				if (FMath::Abs(Residuals[Axis]) >= (1ll << 30))
+				{
+					Mode = 2;
+				}
+				else if (Residuals[Axis] != 0 && Mode == 0)
+				{
+					Mode = 1;
+				}
+			}
+		}
+
+		Ar.SerializeBits(&Mode, 2);
+
+		if (Mode == 2)
+		{
+			return SerializePackedVector<Scale, MaxBitsPerComponent>(Value, Ar);
+		}
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (Mode == 1)
+			{
+				uint32 Packed = ZigZag((int32)Residuals[Axis]);
+				Ar.SerializeIntPacked(Packed);
+				Residuals[Axis] = UnZigZag(Packed);
+			}
+
+			if (Ar.IsLoading())
+			{
+				Value[Axis] = (double)(FMath::RoundToInt64(Reference[Axis] * Scale) + Residuals[Axis]) / (double)Scale;
+			}
+		}
+
+		return true;
+	}
+
+	// Residual between two compressed rotation axis, wraps around
+	inline void SerializeAxisResidual(FArchive& Ar, uint16& Axis, uint16 ReferenceAxis)
+	{
+		uint32 Packed = Ar.IsSaving() ? ZigZag((int16)(Axis - ReferenceAxis)) : 0;
+		Ar.SerializeIntPacked(Packed);
+		Axis = (uint16)(ReferenceAxis + (int16)UnZigZag(Packed));
+	}
+}
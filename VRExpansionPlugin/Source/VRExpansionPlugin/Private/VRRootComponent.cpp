@@ -18,6 +18,7 @@
 #include "Engine/OverlapResult.h"
 #include "Algo/Copy.h"
 #include "AI/Navigation/NavigationRelevantData.h"
+#include "VRCharacterMovementBench.h"
 
 #include "Components/PrimitiveComponent.h"
 
@@ -605,6 +606,7 @@ void UVRRootComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 				if (bAllowWalkingCollision)
 				{
 					bBlockingHit = GetWorld()->SweepSingleByChannel(OutHit, LastPosition, TargetWorldLocation, FQuat::Identity, WalkingCollisionOverride, GetCollisionShape(), Params, ResponseParam);
+					VRCharacterMovementBench::AddCount(VRCharacterMovementBench::ECounter::RootSweeps);
 				}
 
 				if (bBlockingHit && OutHit.Component.IsValid())
@@ -1049,6 +1051,7 @@ bool UVRRootComponent::MoveComponentImpl(const FVector& Delta, const FQuat& NewR
 			Params.bIgnoreTouches |= !(GetGenerateOverlapEvents() || bForceGatherOverlaps);
 			Params.TraceTag = TraceTagName;
 			bool const bHadBlockingHit = MyWorld->ComponentSweepMulti(Hits, this, TraceStart, TraceEnd, InitialRotationQuat, Params);
+			VRCharacterMovementBench::AddCount(VRCharacterMovementBench::ECounter::RootSweeps);
 			//bool const bHadBlockingHit = MyWorld->SweepMultiByChannel(Hits, TraceStart, TraceEnd, InitialRotationQuat, this->GetCollisionObjectType(), this->GetCollisionShape(), Params, ResponseParam);
 
 			if (Hits.Num() > 0)
@@ -368,46 +368,57 @@ public:
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
 		bOutSuccess = true;
-		uint8 MoveActionCount = (uint8)MoveActions.Num();
-		bool bHasAMoveAction = MoveActionCount > 0;
+		bool bHasAMoveAction = MoveActions.Num() > 0;
 		Ar.SerializeBits(&bHasAMoveAction, 1);
 
 		if (bHasAMoveAction)
 		{
-			bool bHasMoreThanOneMoveAction = MoveActionCount > 1;
-			Ar.SerializeBits(&bHasMoreThanOneMoveAction, 1);
+			NetSerializeActions(Ar, Map, bOutSuccess);
+		}
 
-			if (Ar.IsSaving())
+		return bOutSuccess;
+	}
+
+	// Serializes the actions without a presence bit, for when the owner already flagged that there are some
+	bool NetSerializeActions(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		uint8 MoveActionCount = (uint8)MoveActions.Num();
+		bool bHasMoreThanOneMoveAction = MoveActionCount > 1;
+		Ar.SerializeBits(&bHasMoreThanOneMoveAction, 1);
+
+		if (Ar.IsSaving())
+		{
+			if (bHasMoreThanOneMoveAction)
 			{
-				if (bHasMoreThanOneMoveAction)
-				{
-					Ar << MoveActionCount;
+				Ar << MoveActionCount;
 
-					for (int i = 0; i < MoveActionCount; i++)
-					{
-						bOutSuccess &= MoveActions[i].NetSerialize(Ar, Map, bOutSuccess);
-					}
-				}
-				else
+				for (int i = 0; i < MoveActionCount; i++)
 				{
-					bOutSuccess &= MoveActions[0].NetSerialize(Ar, Map, bOutSuccess);
+					bOutSuccess &= MoveActions[i].NetSerialize(Ar, Map, bOutSuccess);
 				}
 			}
 			else
 			{
-				if (bHasMoreThanOneMoveAction)
-				{
-					Ar << MoveActionCount;
-				}
-				else
-					MoveActionCount = 1;
+				bOutSuccess &= MoveActions[0].NetSerialize(Ar, Map, bOutSuccess);
+			}
+		}
+		else
+		{
+			if (bHasMoreThanOneMoveAction)
+			{
+				Ar << MoveActionCount;
+			}
+			else
+				MoveActionCount = 1;
 
-				for (int i = 0; i < MoveActionCount; i++)
-				{
-					FVRMoveActionContainer MoveAction;
-					bOutSuccess &= MoveAction.NetSerialize(Ar, Map, bOutSuccess);
-					MoveActions.Add(MoveAction);
-				}
+			// The receiving move data is reused between moves, replace rather than append
+			MoveActions.Reset(MoveActionCount);
+
+			for (int i = 0; i < MoveActionCount; i++)
+			{
+				FVRMoveActionContainer MoveAction;
+				bOutSuccess &= MoveAction.NetSerialize(Ar, Map, bOutSuccess);
+				MoveActions.Add(MoveAction);
 			}
 		}
 
@@ -444,6 +455,76 @@ public:
 		RequestedVelocity = FVector::ZeroVector;
 	}
 
+	enum EConditionalPresence : uint8
+	{
+		Presence_VRInput = 1 << 0,
+		Presence_RequestedVelocity = 1 << 1,
+		Presence_MoveActions = 1 << 2,
+	};
+
+	// Per move VR input is bounded by the play area, so it is sent with a shared magnitude width and a planar (no Z) flag
+	// Same 2 decimal precision as the packed vector, which is still used if it is out of the +/- 327.67 range
+	static bool SerializeBoundedInputVector(FArchive& Ar, FVector& Vector)
+	{
+		// 0 = 3D, 1 = planar, 2 = out of range
+		uint8 Mode = 0;
+		int32 Quantized[3] = { 0, 0, 0 };
+		uint32 MagnitudeBits = 0;
+
+		if (Ar.IsSaving())
+		{
+			for (int32 Axis = 0; Axis < 3 && Mode != 2; ++Axis)
+			{
+				const double Scaled = Vector[Axis] * 100.0;
+				if (FMath::Abs(Scaled) > 32767.0)
+				{
+					Mode = 2;
+				}
+				else
+				{
+					Quantized[Axis] = (int32)FMath::RoundToInt(Scaled);
+					MagnitudeBits = FMath::Max(MagnitudeBits, 32 - FMath::CountLeadingZeros((uint32)FMath::Abs(Quantized[Axis])));
+				}
+			}
+
+			if (Mode != 2 && Quantized[2] == 0)
+			{
+				Mode = 1;
+			}
+		}
+
+		Ar.SerializeBits(&Mode, 2);
+
+		if (Mode == 2)
+		{
+			return SerializePackedVector<100, 22/*30*/>(Vector, Ar);
+		}
+
+		Ar.SerializeBits(&MagnitudeBits, 4);
+
+		const int32 NumAxis = Mode == 1 ? 2 : 3;
+		for (int32 Axis = 0; Axis < NumAxis; ++Axis)
+		{
+			uint8 bNegative = Quantized[Axis] < 0;
+			uint32 Magnitude = (uint32)FMath::Abs(Quantized[Axis]);
+			Ar.SerializeBits(&bNegative, 1);
+
+			if (MagnitudeBits > 0)
+			{
+				Ar.SerializeBits(&Magnitude, MagnitudeBits);
+			}
+
+			Quantized[Axis] = bNegative ? -(int32)Magnitude : (int32)Magnitude;
+		}
+
+		if (Ar.IsLoading())
+		{
+			Vector = FVector(Quantized[0], Quantized[1], Quantized[2]) / 100.0;
+		}
+
+		return true;
+	}
+
 	/** Network serialization */
 	// Doing a custom NetSerialize here because this is sent via RPCs and should change on every update
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
@@ -452,44 +533,47 @@ public:
 
 		bool bIsLoading = Ar.IsLoading();
 
-		bool bHasVRinput = !CustomVRInputVector.IsZero();
-		bool bHasRequestedVelocity = !RequestedVelocity.IsZero();
-		bool bHasMoveAction = MoveActionArray.MoveActions.Num() > 0;//MoveAction.MoveAction != EVRMoveAction::VRMOVEACTION_None;
+		uint8 PresenceMask = 0;
+		if (!bIsLoading)
+		{
+			PresenceMask |= !CustomVRInputVector.IsZero() ? Presence_VRInput : 0;
+			PresenceMask |= !RequestedVelocity.IsZero() ? Presence_RequestedVelocity : 0;
+			PresenceMask |= MoveActionArray.MoveActions.Num() > 0 ? Presence_MoveActions : 0;
+		}
 
-		bool bHasAnyProperties = bHasVRinput || bHasRequestedVelocity || bHasMoveAction;
+		// Almost every move has nothing in here, so the mask is behind a single bit
+		bool bHasAnyProperties = PresenceMask != 0;
 		Ar.SerializeBits(&bHasAnyProperties, 1);
 
 		if (bHasAnyProperties)
 		{
-			Ar.SerializeBits(&bHasVRinput, 1);
-			Ar.SerializeBits(&bHasRequestedVelocity, 1);
-			//Ar.SerializeBits(&bHasMoveAction, 1);
-
-			if (bHasVRinput)
-			{
-				bOutSuccess &= SerializePackedVector<100, 22/*30*/>(CustomVRInputVector, Ar);
-			}
-			else if (bIsLoading)
-			{
-				CustomVRInputVector = FVector::ZeroVector;
-			}
-
-			if (bHasRequestedVelocity)
-			{
-				bOutSuccess &= SerializePackedVector<100, 22/*30*/>(RequestedVelocity, Ar);
-			}
-			else if (bIsLoading)
-			{
-				RequestedVelocity = FVector::ZeroVector;
-			}
+			Ar.SerializeBits(&PresenceMask, 3);
+		}
 
-			//if (bHasMoveAction)
-			MoveActionArray.NetSerialize(Ar, Map, bOutSuccess);
+		if (PresenceMask & Presence_VRInput)
+		{
+			bOutSuccess &= SerializeBoundedInputVector(Ar, CustomVRInputVector);
 		}
 		else if (bIsLoading)
 		{
 			CustomVRInputVector = FVector::ZeroVector;
+		}
+
+		if (PresenceMask & Presence_RequestedVelocity)
+		{
+			bOutSuccess &= SerializePackedVector<100, 22/*30*/>(RequestedVelocity, Ar);
+		}
+		else if (bIsLoading)
+		{
 			RequestedVelocity = FVector::ZeroVector;
+		}
+
+		if (PresenceMask & Presence_MoveActions)
+		{
+			MoveActionArray.NetSerializeActions(Ar, Map, bOutSuccess);
+		}
+		else if (bIsLoading)
+		{
 			MoveActionArray.Clear();
 		}
 
@@ -639,6 +723,11 @@ public:
 	float CapsuleHeight;
 	FVRConditionalMoveRep ConditionalValues;
 
+	// The location this move was first sent with as a new move, replays change the saved location afterwards
+	// Used as the reference of compact corrections
+	mutable FVector SentLocation;
+	mutable bool bHasSentLocation;
+
 	void Clear();
 	virtual void SetInitialPosition(ACharacter* C);
 	virtual void PrepMoveFor(ACharacter* Character) override;
@@ -742,6 +831,17 @@ public:
 	 */
 	virtual void ServerFillResponseData(const UCharacterMovementComponent& CharacterMovement, const FClientAdjustment& PendingAdjustment) override;
 
+	/**
+	 * Plain position corrections are sent compact when enabled, their location as a residual against the location the client reported for the corrected move.
+	 * Everything else falls back to the engine serialization behind a 1 bit flag.
+	 */
+	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap) override;
+
+	/**
+	 * Body of a compact correction after its time stamp, NewLoc is a residual against LocationReference which both ends have to agree on.
+	 */
+	bool SerializeCompactCorrection(FArchive& Ar, const FVector& LocationReference);
+
 	//bool bHasRotation; // By default ClientAdjustment.NewRot is not serialized. Set this to true after base ServerFillResponseData if you want Rotation to be serialized.
 
 };
\ No newline at end of file
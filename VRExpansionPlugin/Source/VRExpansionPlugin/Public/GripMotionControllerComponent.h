@@ -823,6 +823,13 @@ public:
 	bool bLerpingPosition;
 	bool bReppedOnce;
 
+	// Set on the server while a received pose is waiting on the tracked pose batch subsystem to apply it
+	bool bHasPendingServerPose = false;
+
+	// Bumped whenever replicated state other than the pose changes (grips and settings)
+	// Distance based pose replication uses it to send those changes to throttled connections right away
+	uint32 NonPoseReplicationVersion = 0;
+
 	UFUNCTION()
 	virtual void OnRep_ReplicatedControllerTransform();
 
@@ -838,6 +845,11 @@ protected:
 	float ControllerNetUpdateRate;
 
 public:
+
+	// Settings to adapt the send rate of the controller to its motion and the state of the connection
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking")
+		FBPVRAdaptiveNetUpdateSettings AdaptiveNetUpdateSettings;
+
 	void SetControllerNetUpdateRate(float NewControllerNetUpdateRate);
 	inline float GetControllerNetUpdateRate() { return ControllerNetUpdateRate; };
 	
@@ -866,9 +878,18 @@ public:
 		float NetworkMaxSmoothUpdateDistance = 50.f;
 
 	// Max distance to allow smoothing before snapping entirely to the new position
-	UPROPERTY(EditAnywhere, Category = "GripMotionController|Networking|Smoothing", meta = (editcondition = "bUseExponentialSmoothing"))
+	UPROPERTY(EditAnywhere, Category = "GripMotionController|Networking|Smoothing", meta = (editcondition = "bUseExponentialSmoothing || bUseJitterBufferSmoothing"))
 		float NetworkNoSmoothUpdateDistance = 100.f;
 
+	// If true then received poses are stored in a timestamped jitter buffer and played back with a small delay
+	// Interpolates between buffered samples and extrapolates (bounded) if the buffer runs dry, overrides the exponential smoothing
+	UPROPERTY(EditAnywhere, Category = "GripMotionController|Networking|Smoothing", meta = (editcondition = "bSmoothReplicatedMotion"))
+		bool bUseJitterBufferSmoothing = false;
+
+	// Settings and storage for the jitter buffer smoothing
+	UPROPERTY(EditAnywhere, Category = "GripMotionController|Networking|Smoothing", meta = (editcondition = "bUseJitterBufferSmoothing"))
+		FBPVRPoseJitterBuffer NetworkJitterBuffer;
+
 	protected:
 
 	// Whether to replicate even if no tracking (FPS or test characters)
@@ -39,6 +39,11 @@ public:
 	virtual void GatherCurrentMovement() override;
 
 protected:
+
+	// ReplicatedMovement as of the last time it was marked dirty, GatherCurrentMovement compares against this
+	// so that drift under the quantization step each gather still adds up to an update
+	FRepMovement LastDirtiedRepMovement;
+
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadOnly, Instanced, Category = "VRGripInterface")
 		TArray<TObjectPtr<UVRGripScriptBase>> GripLogicScripts;
 
@@ -33,6 +33,8 @@
 //struct FAsyncPhysicsRepCallbackDataVR;
 //class FPhysicsReplicationAsyncCallbackVR;
 
+struct FVRPhysicsReplicationCorrectionProfile;
+
 #pragma region FPhysicsReplicationAsync
 
 class FPhysicsReplicationAsyncVR : public Chaos::TSimCallbackObject<
@@ -49,7 +51,50 @@ class FPhysicsReplicationAsyncVR : public Chaos::TSimCallbackObject<
 
 	// Replication functions
 	virtual void DefaultReplication_DEPRECATED(Chaos::FRigidBodyHandle_Internal* Handle, const FPhysicsRepAsyncInputData& State, const float DeltaSeconds, const FPhysicsRepErrorCorrectionData& ErrorCorrection);
+	// Default replication settings, resolved once per step
+	struct FDefaultReplicationParams
+	{
+		float NetPingExtrapolation = 0.0f;
+		float NetPingLimit = 0.0f;
+		float ErrorPerLinearDiff = 0.0f;
+		float ErrorPerAngularDiff = 0.0f;
+		float MaxRestoredStateError = 0.0f;
+		float ErrorAccumulationSeconds = 0.0f;
+		float ErrorAccumulationDistanceSq = 0.0f;
+		float ErrorAccumulationSimilarity = 0.0f;
+		float PositionLerp = 0.0f;
+		float LinearVelocityCoefficient = 0.0f;
+		float AngleLerp = 0.0f;
+		float AngularVelocityCoefficient = 0.0f;
+		float MaxLinearHardSnapDistance = 0.0f;
+		bool bDisableReplicationOnInteraction = false;
+	};
+
+	// Output of the default replication compute pass for a single body, written to the particle in the serial apply pass
+	struct FDefaultReplicationCorrection
+	{
+		FVector NewPos = FVector::ZeroVector;
+		FQuat NewRot = FQuat::Identity;
+		FVector NewLinVel = FVector::ZeroVector;
+		FVector NewAngVel = FVector::ZeroVector; // Radians
+		bool bSetState = false;
+		bool bShouldSleep = false;
+		bool bRestoredState = true;
+	};
+
+	FDefaultReplicationParams GatherDefaultReplicationParams() const;
+
+	// No longer called, forwards to the overload below with this steps params
+	UE_DEPRECATED(5.4, "Override ComputeDefaultReplication / ApplyDefaultReplication instead, they are run by both the serial and the parallel pass")
 	virtual bool DefaultReplication(Chaos::FPBDRigidParticleHandle* Handle, FReplicatedPhysicsTargetAsync& Target, const float DeltaSeconds);
+
+	// Serial default replication, a compute followed by an apply for a single body
+	bool DefaultReplication(Chaos::FPBDRigidParticleHandle* Handle, FReplicatedPhysicsTargetAsync& Target, const float DeltaSeconds, const FDefaultReplicationParams& Params);
+
+	// Default replication override points, shared by the serial and the parallel pass (vrexp.PhysicsReplication.ParallelCorrectionThreshold).
+	// Compute may run on worker threads, overrides must only read the particle and write to the passed in target and correction.
+	virtual void ComputeDefaultReplication(const Chaos::FPBDRigidParticleHandle* Handle, FReplicatedPhysicsTargetAsync& Target, const float DeltaSeconds, const FDefaultReplicationParams& Params, FDefaultReplicationCorrection& OutCorrection) const;
+	virtual bool ApplyDefaultReplication(Chaos::FPBDRigidParticleHandle* Handle, const FDefaultReplicationCorrection& Correction);
 	virtual bool PredictiveInterpolation(Chaos::FPBDRigidParticleHandle* Handle, FReplicatedPhysicsTargetAsync& Target, const float DeltaSeconds);
 	virtual bool ResimulationReplication(Chaos::FPBDRigidParticleHandle* Handle, FReplicatedPhysicsTargetAsync& Target, const float DeltaSeconds);
 
@@ -61,17 +106,61 @@ private:
 	FRigidBodyErrorCorrection ErrorCorrectionDefault;
 	FNetworkPhysicsSettingsAsync SettingsCurrent;
 	FNetworkPhysicsSettingsAsync SettingsDefault;
-	TMap<Chaos::FConstPhysicsObjectHandle, FReplicatedPhysicsTargetAsync> ObjectToTarget;
-	TMap<Chaos::FConstPhysicsObjectHandle, FNetworkPhysicsSettingsAsync> ObjectToSettings;
 	TArray<int32> ParticlesInResimIslands;
 
+	// Replication targets are stored as dense parallel arrays so the per step passes walk contiguous memory.
+	// The handle maps are only touched when a target / settings entry is added or removed, removal is a swap-remove.
+	TArray<Chaos::FConstPhysicsObjectHandle> TargetObjects;
+	TArray<FReplicatedPhysicsTargetAsync> Targets;
+	TArray<int32> TargetSettingsIndices; // Index into Settings, INDEX_NONE to use SettingsDefault
+	TMap<Chaos::FConstPhysicsObjectHandle, int32> ObjectToTargetIndex;
+
+	// Per tick rotation delta of a target, only rebuilt when a new target state arrives or the step time changes
+	struct FTargetExtrapolationCache
+	{
+		FQuat StepRotation = FQuat::Identity;
+		float StepSeconds = -1.0f;
+	};
+	TArray<FTargetExtrapolationCache> TargetExtrapolationCaches;
+	FTargetExtrapolationCache* ExtrapolationCacheCurrent = nullptr; // Slot of the target being replicated, set around the per target replication call like SettingsCurrent
+
+	TArray<Chaos::FConstPhysicsObjectHandle> SettingsObjects;
+	TArray<FNetworkPhysicsSettingsAsync> Settings;
+	TMap<Chaos::FConstPhysicsObjectHandle, int32> ObjectToSettingsIndex;
+
+	// Default replication params for the current step, used by the deprecated DefaultReplication overload
+	FDefaultReplicationParams DefaultParamsCurrent;
+
+	// Scratch storage for the parallel default replication pass, indexed by target index
+	TArray<int32> ParallelTargetIndices;
+	TArray<FDefaultReplicationCorrection> ParallelCorrections;
+
+	// Scratch storage for island replication, indexed by target index
+	TArray<int32> IslandCandidateTargets; // Target indices that can be grouped this step
+	TArray<int32> TargetIslands;
+	TArray<bool> IslandFollowers;
+	TMap<int32, int32> IslandReferenceTargets; // Island index to the target index leading it
+
 private:
 	void UpdateAsyncTarget(const FPhysicsRepAsyncInputData& Input, Chaos::FPBDRigidsSolver* RigidsSolver);
 	void UpdateRewindDataTarget(const FPhysicsRepAsyncInputData& Input);
 	void CacheResimInteractions();
-	// Sets SettingsCurrent to either the objects custom settings or to the default settings
-	void FetchObjectSettings(Chaos::FConstPhysicsObjectHandle PhysicsObject);
+	// Marks targets that share a simulation island with a heavier replicated body, only that reference body is corrected
+	void CacheIslandFollowers();
+	// Sets SettingsCurrent to either the targets custom settings or to the default settings
+	void FetchTargetSettings(int32 TargetIndex);
+
+	// Dense target storage management
+	int32 AddTarget(Chaos::FConstPhysicsObjectHandle PhysicsObject);
+	void RemoveTarget(Chaos::FConstPhysicsObjectHandle PhysicsObject);
+	void RemoveTargetAtIndex(int32 TargetIndex);
+	void RemoveSettings(Chaos::FConstPhysicsObjectHandle PhysicsObject);
+
+	// True if the target and its particle are both asleep at the same pose
+	bool IsTargetResting(const Chaos::FPBDRigidParticleHandle* Handle, const FReplicatedPhysicsTargetAsync& Target) const;
 	static void ExtrapolateTarget(FReplicatedPhysicsTargetAsync& Target, const int32 ExtrapolateFrames, const float DeltaSeconds);
+	// Single tick extrapolation using the targets cached step rotation, uncached if ExtrapolationCache is null
+	static void ExtrapolateTargetStep(FReplicatedPhysicsTargetAsync& Target, FTargetExtrapolationCache* ExtrapolationCache, const float DeltaSeconds);
 
 public:
 	void Setup(FRigidBodyErrorCorrection ErrorCorrection)
@@ -107,6 +196,26 @@ public:
 	FPhysicsReplicationAsyncInput* AsyncInputVR;	//async data being written into before we push into callback
 
 	void PrepareAsyncData_ExternalVR(const FRigidBodyErrorCorrection& ErrorCorrection);	//prepare async data for writing. Call on external thread (i.e. game thread)
+
+private:
+
+	struct FCorrectionCandidateVR
+	{
+		UPrimitiveComponent* Component = nullptr;
+		float ErrorScale = 1.0f;
+		float Priority = 0.0f;
+	};
+
+	// Fills CorrectionErrorScales with the bodies to correct this frame and the scale for their error tolerances
+	void PrioritizeCorrections(const TMap<TWeakObjectPtr<UPrimitiveComponent>, FReplicatedPhysicsTarget>& ComponentsToTargets, const FVRPhysicsReplicationCorrectionProfile& CorrectionProfile);
+
+	TMap<const UPrimitiveComponent*, float> CorrectionErrorScales;
+
+	// World time that bodies left out of the correction budget started waiting, used to age their priority
+	TMap<const UPrimitiveComponent*, double> CorrectionWaitStartTimes;
+	TMap<const UPrimitiveComponent*, double> CorrectionWaitStartTimesScratch;
+	TArray<FCorrectionCandidateVR> CorrectionCandidates;
+	TArray<FVector> ViewerLocations;
 };
 
 
@@ -143,7 +252,13 @@ public:
 	FRepMovementVR(FRepMovement& other);
 	void CopyTo(FRepMovement& other) const;
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+	// Bounded velocities, smallest three rotation and optional angular velocity, see FVRRepMovementCompactSettings
+	bool NetSerializeCompact(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess, const struct FVRRepMovementCompactSettings& CompactSettings);
 	bool GatherActorsMovement(AActor* OwningActor);
+
+	// Returns true if the two movements would serialize differently at the current quantization levels
+	// Used to only push model dirty ReplicatedMovement when a body actually moved
+	static bool HasChangedBeyondQuantization(const FRepMovement& Previous, const FRepMovement& Current, bool bCompareServerFrame);
 };
 
 template<>
@@ -170,18 +285,61 @@ public:
 	UPROPERTY(EditAnywhere, NotReplicated, BlueprintReadOnly, Category = "VRReplication", meta = (ClampMin = "0", UIMin = "0", ClampMax = "100", UIMax = "100"))
 		int32 UpdateRate;
 
+	// If true then instead of sending every update we send the release state and then only send corrections when the
+	// local simulation drifts off of the ballistic path predicted from the last sent state (and the final resting state).
+	// The server simulates the object forward on its own in between.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRReplication")
+		bool bUseTrajectoryCompression;
+
+	// Distance (cm) from the predicted trajectory that triggers a correction when using trajectory compression, not replicated, only serialized
+	UPROPERTY(EditAnywhere, NotReplicated, BlueprintReadOnly, Category = "VRReplication", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseTrajectoryCompression"))
+		float TrajectoryPositionErrorThreshold;
+
+	// Angle (degrees) from the predicted rotation that triggers a correction when using trajectory compression, not replicated, only serialized
+	UPROPERTY(EditAnywhere, NotReplicated, BlueprintReadOnly, Category = "VRReplication", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseTrajectoryCompression"))
+		float TrajectoryRotationErrorThreshold;
+
 	FTimerHandle ResetReplicationHandle;
 	FTransform LastActorTransform;
 	float TimeAtInitialThrow;
 	bool bIsCurrentlyClientAuth;
 
+	// Last state sent to the server, the base of the predicted trajectory
+	FRepMovement LastSentMovement;
+	float TimeAtLastSend;
+	bool bHasSentTrajectory;
+
 	FVRClientAuthReplicationData() :
 		bUseClientAuthThrowing(false),
 		UpdateRate(30),
+		bUseTrajectoryCompression(false),
+		TrajectoryPositionErrorThreshold(5.0f),
+		TrajectoryRotationErrorThreshold(10.0f),
 		LastActorTransform(FTransform::Identity),
 		TimeAtInitialThrow(0.0f),
-		bIsCurrentlyClientAuth(false)
+		bIsCurrentlyClientAuth(false),
+		TimeAtLastSend(0.0f),
+		bHasSentTrajectory(false)
 	{
 
 	}
+
+	// Returns true if this movement should be sent to the server, always true unless using trajectory compression
+	bool ShouldSendMovement(const FRepMovement& CurrentMovement, float CurrentTime, float GravityZ) const;
+
+	// Records a movement that was sent to the server as the new trajectory base
+	void NotifyMovementSent(const FRepMovement& SentMovement, float CurrentTime);
+
+	// Gathers the owners movement and hands it to SendFunc if it should go to the server (always if bForceSend).
+	// Returns false if the movement could not be gathered.
+	bool SendMovementIfNeeded(AActor* OwningActor, bool bForceSend, TFunctionRef<void(const FRepMovementVR&)> SendFunc);
+
+	// Server side application of a received client auth movement
+	void ApplyReceivedMovement(AActor* OwningActor, const FRepMovementVR& NewMovement) const;
+
+	// Clears the trajectory so that the next movement is always sent
+	void ResetTrajectory()
+	{
+		bHasSentTrajectory = false;
+	}
 };
\ No newline at end of file
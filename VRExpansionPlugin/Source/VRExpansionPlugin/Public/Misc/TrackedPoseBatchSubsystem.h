@@ -0,0 +1,81 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "TrackedPoseBatchSubsystem.generated.h"
+
+class USceneComponent;
+class UTrackedPoseBatchSubsystem;
+
+/**
+* Tick function that applies the batched poses, runs in PrePhysics ahead of the tracked components and their owners
+**/
+USTRUCT()
+struct FTrackedPoseBatchTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+		UTrackedPoseBatchSubsystem* Target = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph. */
+	virtual FString DiagnosticMessage() override;
+	/** Function used to describe this tick for active tick reporting. **/
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTrackedPoseBatchTickFunction> : public TStructOpsTypeTraitsBase2<FTrackedPoseBatchTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+// Queues incoming tracked device poses (controllers / HMD) on the server and applies the newest one per device
+// in a single batched pass per tick, instead of applying each RPC as it arrives.
+// Enabled with bBatchServerTrackedPoseUpdates in the VRGlobalSettings, the subsystem isn't created otherwise.
+UCLASS()
+class VREXPANSIONPLUGIN_API UTrackedPoseBatchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UTrackedPoseBatchSubsystem() :
+		Super()
+	{
+
+	}
+
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override
+	{
+		return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+		// Not allowing for editor type as this is a replication subsystem
+	}
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// Returns the subsystem if incoming poses should be queued for the batched pass instead of applied directly
+	static UTrackedPoseBatchSubsystem* GetActiveBatchSubsystem(const UObject* WorldContextObject);
+
+	// Queues a tracked component to have its newest replicated pose applied in the next batched pass
+	// Components are only queued once no matter how many poses arrive for them within the tick
+	void QueuePendingPose(USceneComponent* TrackedComponent);
+
+	// Applies all of the pending poses
+	void ApplyPendingPoses();
+
+private:
+
+	FTrackedPoseBatchTickFunction BatchTickFunction;
+
+	// Components with a pending pose, the pose itself lives in the components replicated transform
+	TArray<TWeakObjectPtr<USceneComponent>> PendingComponents;
+};
@@ -117,6 +117,13 @@ public:
 	bool bLerpingPosition;
 	bool bReppedOnce;
 
+	// Set on the server while a received pose is waiting on the tracked pose batch subsystem to apply it
+	bool bHasPendingServerPose = false;
+
+	// Bumped whenever replicated state other than the pose changes (settings)
+	// Distance based pose replication uses it to send those changes to throttled connections right away
+	uint32 NonPoseReplicationVersion = 0;
+
 	// Run the smoothing step
 	void RunNetworkedSmoothing(float DeltaTime);
 
@@ -138,8 +145,17 @@ public:
 		float NetworkMaxSmoothUpdateDistance = 50.f;
 
 	// Max distance to allow smoothing before snapping entirely to the new position
-	UPROPERTY(EditAnywhere, Category = "ReplicatedCamera|Networking|Smoothing", meta = (editcondition = "bUseExponentialSmoothing"))
+	UPROPERTY(EditAnywhere, Category = "ReplicatedCamera|Networking|Smoothing", meta = (editcondition = "bUseExponentialSmoothing || bUseJitterBufferSmoothing"))
 		float NetworkNoSmoothUpdateDistance = 100.f;
+
+	// If true then received poses are stored in a timestamped jitter buffer and played back with a small delay
+	// Interpolates between buffered samples and extrapolates (bounded) if the buffer runs dry, overrides the exponential smoothing
+	UPROPERTY(EditAnywhere, Category = "ReplicatedCamera|Networking|Smoothing", meta = (editcondition = "bSmoothReplicatedMotion"))
+		bool bUseJitterBufferSmoothing = false;
+
+	// Settings and storage for the jitter buffer smoothing
+	UPROPERTY(EditAnywhere, Category = "ReplicatedCamera|Networking|Smoothing", meta = (editcondition = "bUseJitterBufferSmoothing"))
+		FBPVRPoseJitterBuffer NetworkJitterBuffer;
 	
 	UFUNCTION()
     virtual void OnRep_ReplicatedCameraTransform();
@@ -151,6 +167,10 @@ protected:
 	float NetUpdateRate;
 public:
 
+	// Settings to adapt the send rate of the camera to its motion and the state of the connection
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ReplicatedCamera|Networking")
+		FBPVRAdaptiveNetUpdateSettings AdaptiveNetUpdateSettings;
+
 	// Used in Tick() to accumulate before sending updates, didn't want to use a timer in this case.
 	float NetUpdateCount;
 
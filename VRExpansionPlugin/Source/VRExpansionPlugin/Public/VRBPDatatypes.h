@@ -15,6 +15,7 @@
 class UGripMotionControllerComponent;
 class UVRGripScriptBase;
 class UPrimitiveComponent;
+class AActor;
 
 // Custom movement modes for the characters
 UENUM(BlueprintType)
@@ -481,6 +482,183 @@ public:
 	}
 };
 
+struct FBPVRComponentPosRep;
+
+// A single received pose stored in the jitter buffer, stamped with the senders time
+struct FBPVRPoseJitterSample
+{
+	double Timestamp;
+	FVector Position;
+	FQuat Rotation;
+
+	FBPVRPoseJitterSample() :
+		Timestamp(0.0),
+		Position(FVector::ZeroVector),
+		Rotation(FQuat::Identity)
+	{}
+
+	FBPVRPoseJitterSample(double InTimestamp, const FVector& InPosition, const FQuat& InRotation) :
+		Timestamp(InTimestamp),
+		Position(InPosition),
+		Rotation(InRotation)
+	{}
+};
+
+// A timestamped jitter buffer for replicated tracked device poses (controllers / HMD)
+// Samples are stamped with the senders clock and played back at a fixed delay behind the estimated sender time and interpolated between,
+// if the buffer runs dry then it extrapolates off of the last received velocity for a bounded duration.
+USTRUCT(BlueprintType, Category = "VRExpansionLibrary")
+struct VREXPANSIONPLUGIN_API FBPVRPoseJitterBuffer
+{
+	GENERATED_BODY()
+public:
+
+	FBPVRPoseJitterBuffer() :
+		BufferDelayMs(50.0f),
+		MaxExtrapolationMs(100.0f),
+		MaxExtrapolationVelocity(500.0f),
+		MaxExtrapolationAngularVelocity(720.0f),
+		MaxBufferedSamples(16)
+	{}
+
+	// How far behind the estimated sender time to play back samples, should be slightly larger than the send interval + expected jitter
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JitterBuffer", meta = (ClampMin = "0", UIMin = "0"))
+		float BufferDelayMs;
+
+	// The maximum amount of time that we will extrapolate past the last received sample before holding position
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JitterBuffer", meta = (ClampMin = "0", UIMin = "0"))
+		float MaxExtrapolationMs;
+
+	// The maximum linear velocity (UU per second) that will be used when extrapolating
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JitterBuffer", meta = (ClampMin = "0", UIMin = "0"))
+		float MaxExtrapolationVelocity;
+
+	// The maximum angular velocity (degrees per second) that will be used when extrapolating
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JitterBuffer", meta = (ClampMin = "0", UIMin = "0"))
+		float MaxExtrapolationAngularVelocity;
+
+	// The maximum number of samples to hold, older samples are dropped first
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "JitterBuffer", meta = (ClampMin = "2", UIMin = "2"))
+		int32 MaxBufferedSamples;
+
+	// Clears out all buffered samples
+	void Reset();
+
+	// Returns true if there are samples available to play back
+	inline bool HasSamples() const
+	{
+		return Samples.Num() > 0;
+	}
+
+	// Adds a newly received pose, uses the senders timestamp if the pose has one and the local arrival time otherwise
+	// Position is passed in separately as the camera adjusts the replicated position before buffering it
+	void AddSample(double ArrivalTime, const FBPVRComponentPosRep& Pose, const FVector& Position);
+
+	// Adds a newly received pose that is already stamped in the buffers time
+	void AddSample(double Timestamp, const FVector& Position, const FQuat& Rotation);
+
+	// Samples the buffer at the current local time, returns false if there are no samples to play back
+	// bOutIsExtrapolating is set if the buffer ran dry and the result was predicted past the newest sample
+	bool SamplePose(double CurrentTime, FVector& OutPosition, FQuat& OutRotation, bool& bOutIsExtrapolating);
+
+	// Returns true once playback has reached the newest sample and the extrapolation window past it has run out,
+	// there is nothing left to play back until another sample is added
+	bool HasFinishedPlayback(double CurrentTime) const;
+
+	// Gets the newest buffered position, returns false if the buffer is empty
+	bool GetNewestPosition(FVector& OutPosition) const;
+
+private:
+
+	TArray<FBPVRPoseJitterSample> Samples;
+
+	// The last sample dropped from the buffer, used to get a velocity when only a single sample remains
+	FBPVRPoseJitterSample ExtrapolationBase;
+	bool bHasExtrapolationBase = false;
+
+	// Sender clock tracking, sender times are unwrapped from the 16 bit millisecond stamps
+	// and mapped to local time with the smallest (least delayed) arrival offset seen
+	double UnwrappedSenderTime = 0.0;
+	double LastArrivalTime = 0.0;
+	double ClockOffset = 0.0;
+	uint16 LastSenderTimeMs = 0;
+	bool bHasSenderClock = false;
+	bool bUsingSenderClock = false;
+};
+
+// Settings for adaptively scaling the send rate of tracked device poses (controllers / HMD)
+// Skips sends while the device is idle, raises the rate during fast motion, and caps it when the connection is saturated
+USTRUCT(BlueprintType, Category = "VRExpansionLibrary")
+struct VREXPANSIONPLUGIN_API FBPVRAdaptiveNetUpdateSettings
+{
+	GENERATED_BODY()
+public:
+
+	FBPVRAdaptiveNetUpdateSettings() :
+		bUseAdaptiveUpdateRate(false),
+		PositionThreshold(0.1f),
+		RotationThreshold(0.5f),
+		MaxIdleSendInterval(1.0f),
+		FastMotionVelocity(150.0f),
+		FastMotionAngularVelocity(360.0f),
+		FastMotionUpdateRate(120.0f),
+		SaturatedUpdateRate(30.0f)
+	{}
+
+	// If true the send rate will adapt to the motion of the device and the state of the connection
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdaptiveNetUpdate")
+		bool bUseAdaptiveUpdateRate;
+
+	// Distance (UU) from the last sent position that we will not bother sending an update within
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdaptiveNetUpdate", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseAdaptiveUpdateRate"))
+		float PositionThreshold;
+
+	// Angle (degrees) from the last sent rotation that we will not bother sending an update within
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdaptiveNetUpdate", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseAdaptiveUpdateRate"))
+		float RotationThreshold;
+
+	// Maximum time (seconds) to go without sending while within the thresholds, 0 will never refresh an idle device
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdaptiveNetUpdate", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseAdaptiveUpdateRate"))
+		float MaxIdleSendInterval;
+
+	// Linear velocity (UU per second) above which the device is considered to be in fast motion (throws, swings)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdaptiveNetUpdate", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseAdaptiveUpdateRate"))
+		float FastMotionVelocity;
+
+	// Angular velocity (degrees per second) above which the device is considered to be in fast motion
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdaptiveNetUpdate", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseAdaptiveUpdateRate"))
+		float FastMotionAngularVelocity;
+
+	// Update rate to use while in fast motion, will not lower the normal update rate
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdaptiveNetUpdate", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseAdaptiveUpdateRate"))
+		float FastMotionUpdateRate;
+
+	// Update rate to cap to when the owning connection is saturated, 0 will not cap
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdaptiveNetUpdate", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseAdaptiveUpdateRate"))
+		float SaturatedUpdateRate;
+
+	// Returns the update rate to use for this frame, returns 0.0 if the send should be skipped entirely
+	float GetAdaptiveUpdateRate(float BaseUpdateRate, const FVector& NewPosition, const FRotator& NewRotation, const FVector& LastSentPosition, const FRotator& LastSentRotation, float TimeSinceLastSend, bool bConnectionSaturated) const;
+
+	// Returns true if this is the owning client and its net connection currently can't take more data
+	static bool IsOwningConnectionSaturated(const AActor* OwningActor);
+};
+
+// Quantization profiles for FTransform_NetQuantize, each one is range and precision bounded
+// Both ends need to use the same profile for a given property, they are selected at the serialization site
+UENUM()
+enum class EVRTransformQuantizationProfile : uint8
+{
+	// The original quantization, 2 decimal packed translation and scale with short compressed rotation
+	Default = 0,
+	// For transforms that stay close to their parent (grip relative transforms)
+	// +/- 2 meters at ~0.06mm translation, 15 bit smallest three rotation (~0.005 deg), 1 bit for unit scale
+	// Falls back to the default packed translation if out of range
+	HandLocal = 1,
+	// For world space transforms, 1 decimal packed translation (+/- 8.3km), 12 bit smallest three rotation (~0.04 deg), 1 bit for unit scale
+	WorldSpace = 2
+};
+
 // Some static vars so we don't have to keep calculating these for our Smallest Three compression
 namespace TransNetQuant
 {
@@ -530,6 +708,9 @@ public:
 
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
 
+	// Serializes using one of the quantization profiles instead of the default one
+	bool NetSerializeWithProfile(EVRTransformQuantizationProfile Profile, FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
 	// Serializes a quaternion with the Smallest Three alg
 	// Referencing the implementation from https://gafferongames.com/post/snapshot_compression/
 	// Which appears to be the mostly widely referenced method
@@ -731,6 +912,62 @@ struct TStructOpsTypeTraits< FTransform_NetQuantize > : public TStructOpsTypeTra
 	};
 };
 
+// A transform that replicates with the HandLocal quantization profile, use for properties that stay close to their parent
+USTRUCT(BlueprintType, Category = "VRExpansionLibrary|TransformNetQuantize")
+struct FTransform_NetQuantizeHandLocal : public FTransform_NetQuantize
+{
+	GENERATED_USTRUCT_BODY()
+
+	FORCEINLINE FTransform_NetQuantizeHandLocal() : FTransform_NetQuantize()
+	{}
+
+	FORCEINLINE FTransform_NetQuantizeHandLocal(const FTransform& InTransform) : FTransform_NetQuantize(InTransform)
+	{}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		return NetSerializeWithProfile(EVRTransformQuantizationProfile::HandLocal, Ar, Map, bOutSuccess);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FTransform_NetQuantizeHandLocal > : public TStructOpsTypeTraitsBase2<FTransform_NetQuantizeHandLocal>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithNetSharedSerialization = true,
+	};
+};
+
+// A transform that replicates with the WorldSpace quantization profile
+USTRUCT(BlueprintType, Category = "VRExpansionLibrary|TransformNetQuantize")
+struct FTransform_NetQuantizeWorldSpace : public FTransform_NetQuantize
+{
+	GENERATED_USTRUCT_BODY()
+
+	FORCEINLINE FTransform_NetQuantizeWorldSpace() : FTransform_NetQuantize()
+	{}
+
+	FORCEINLINE FTransform_NetQuantizeWorldSpace(const FTransform& InTransform) : FTransform_NetQuantize(InTransform)
+	{}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		return NetSerializeWithProfile(EVRTransformQuantizationProfile::WorldSpace, Ar, Map, bOutSuccess);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FTransform_NetQuantizeWorldSpace > : public TStructOpsTypeTraitsBase2<FTransform_NetQuantizeWorldSpace>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithNetSharedSerialization = true,
+	};
+};
+
 UENUM()
 enum class EVRVectorQuantization : uint8
 {
@@ -783,9 +1020,23 @@ public:
 		return (Angle * 360.f / 1024.f);
 	}
 
+	// Senders clock in milliseconds (wrapping), only sent when bHasSenderTime is set
+	// Used by the jitter buffer smoothing to play poses back in the order and spacing they were sampled at
+	uint16 SenderTimeMs;
+	bool bHasSenderTime;
+
+	// Stamps this pose with the senders clock, called right before sending
+	FORCEINLINE void SetSenderTime(double TimeSeconds)
+	{
+		SenderTimeMs = (uint16)(((uint64)(TimeSeconds * 1000.0)) & 0xFFFF);
+		bHasSenderTime = true;
+	}
+
 	FBPVRComponentPosRep():
 		QuantizationLevel(EVRVectorQuantization::RoundTwoDecimals),
-		RotationQuantizationLevel(EVRRotationQuantization::RoundToShort)
+		RotationQuantizationLevel(EVRRotationQuantization::RoundToShort),
+		SenderTimeMs(0),
+		bHasSenderTime(false)
 	{
 		//QuantizationLevel = EVRVectorQuantization::RoundTwoDecimals;
 		Position = FVector::ZeroVector;
@@ -803,6 +1054,14 @@ public:
 		Ar.SerializeBits(&QuantizationLevel, 1); // Only two values 0:1
 		Ar.SerializeBits(&RotationQuantizationLevel, 1); // Only two values 0:1
 
+		uint8 bSendTime = bHasSenderTime ? 1 : 0;
+		Ar.SerializeBits(&bSendTime, 1);
+		bHasSenderTime = bSendTime != 0;
+		if (bHasSenderTime)
+		{
+			Ar << SenderTimeMs;
+		}
+
 		// No longer using their built in rotation rep, as controllers will rarely if ever be at 0 rot on an axis and 
 		// so the 1 bit overhead per axis is just that, overhead
 		//Rotation.SerializeCompressedShort(Ar);
@@ -1347,7 +1606,8 @@ public:
 		{
 			Ar << SecondaryAttachment;
 			//Ar << SecondaryRelativeLocation;
-			SecondaryRelativeTransform.NetSerialize(Ar, Map, bOutSuccess);
+			// Secondary grips are relative to the gripped object, they are almost always in hand range
+			SecondaryRelativeTransform.NetSerializeWithProfile(EVRTransformQuantizationProfile::HandLocal, Ar, Map, bOutSuccess);
 
 			//Ar << bIsSlotGrip;
 			Ar.SerializeBits(&bIsSlotGrip, 1);
@@ -14,9 +14,20 @@ class UGripMotionControllerComponent;
 class UParentRelativeAttachmentComponent;
 class AController;
 class UNavigationQueryFilter;
+class UActorChannel;
+class UNetConnection;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogBaseVRCharacter, Log, All);
 
+// Distance based pose replication state for a single connection
+struct FVRPoseReplicationConnectionState
+{
+	double LastReplicationTime = -UE_BIG_NUMBER;
+
+	// Last non pose state versions sent for the camera, left and right controllers
+	uint32 SentStateVersions[3] = { 0, 0, 0 };
+};
+
 /** Delegate for notification when the lever state changes. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FVRSeatThresholdChangedSignature, bool, bIsWithinThreshold, float, ToThresholdScaler);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FVRPlayerStateReplicatedSignature, const APlayerState *, NewPlayerState);
@@ -330,6 +341,37 @@ public:
 		void Server_SendTransformRightController(FBPVRComponentPosRep NewTransform);
 
 	virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
+	virtual bool ReplicateSubobjects(UActorChannel* Channel, class FOutBunch* Bunch, FReplicationFlags* RepFlags) override;
+
+	// If true the tracked component poses (camera and motion controllers) will replicate at a lower rate to connections that are viewing from far away
+	// Grips, grip scripts and other replicated state on those components are not throttled.
+	// Only functions when not using the registered sub object list, as it relies on the per connection ReplicateSubobjects call,
+	// characters using the registered list (bReplicateUsingRegisteredSubObjectList) always replicate the poses at full rate.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacter|Networking|DistanceBasedPoseRate")
+		bool bUseDistanceBasedPoseReplication;
+
+	// Viewers closer than this distance receive the tracked components at the full replication rate
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacter|Networking|DistanceBasedPoseRate", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseDistanceBasedPoseReplication"))
+		float PoseReplicationNearDistance;
+
+	// Viewers further than this distance receive the tracked components at the PoseReplicationFarRate, the rate is blended between the near and far distances
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacter|Networking|DistanceBasedPoseRate", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseDistanceBasedPoseReplication"))
+		float PoseReplicationFarDistance;
+
+	// Updates per second that far viewers will receive the tracked components at
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacter|Networking|DistanceBasedPoseRate", meta = (ClampMin = "1", UIMin = "1", editcondition = "bUseDistanceBasedPoseReplication"))
+		float PoseReplicationFarRate;
+
+	// Updates per second that viewers at the near distance will receive the tracked components at, they are unthrottled inside of it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacter|Networking|DistanceBasedPoseRate", meta = (ClampMin = "1", UIMin = "1", editcondition = "bUseDistanceBasedPoseReplication"))
+		float PoseReplicationNearRate;
+
+	// Returns the minimum interval between tracked component updates for the given connection, 0.0 means unthrottled
+	float GetPoseReplicationInterval(const UNetConnection* Connection) const;
+
+	// Per connection pose throttling state, closed connections are pruned when a new one is added
+	TMap<TObjectKey<UNetConnection>, FVRPoseReplicationConnectionState> PoseReplicationConnectionStates;
+	void PrunePoseReplicationConnectionStates();
 
 protected:
 	// If true will replicate the capsule height on to clients, allows for dynamic capsule height changes in multiplayer
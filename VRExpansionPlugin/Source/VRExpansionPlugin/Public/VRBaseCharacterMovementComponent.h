@@ -61,6 +61,103 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing")
 		bool bDisableSimulatedTickWhenSmoothingMovement;
 
+	// When true remote proxies that are far from every local view tick at a reduced rate
+	// and skip their movement estimation and floor checks, only interpolating toward the replicated location
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing")
+		bool bUseSimulatedProxyLOD;
+
+	// Distance from the closest local view after which a remote proxy is considered far
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing", meta = (ClampMin = "0.0", UIMin = "0", editcondition = "bUseSimulatedProxyLOD"))
+		float SimulatedProxyLODDistance;
+
+	// Simulation and smoothing rate in hz of far remote proxies, 0 keeps ticking every frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing", meta = (ClampMin = "0.0", UIMin = "0", editcondition = "bUseSimulatedProxyLOD"))
+		float SimulatedProxyLODUpdateRate;
+
+	// Remote proxies further than this from the closest local view skip the repulsion force entirely
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Smoothing", meta = (ClampMin = "0.0", UIMin = "0", editcondition = "bUseSimulatedProxyLOD"))
+		float SimulatedProxyRepulsionDistance;
+
+	// Squared distance from this characters capsule to the closest local players camera
+	float GetClosestLocalViewDistanceSquared() const;
+
+	// When true saved moves with HMD movement, custom input vectors, matching requested velocities and small capsule height changes can still be combined
+	// The HMD and custom input offsets are summed across the combined moves, both the client and the server clamp each moves offsets to the same limit
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Networking")
+		bool bUseRelaxedMoveCombining;
+
+	// Capsule half height changes up to this size don't prevent relaxed combining, the newest height is sent
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Networking", meta = (ClampMin = "0.0", UIMin = "0", editcondition = "bUseRelaxedMoveCombining"))
+		float RelaxedCombineCapsuleHeightTolerance;
+
+	// Max speed (cm/s) of the HMD / custom input offsets, a move can carry at most this times its delta time (plus RelaxedCombineVROffsetTolerance)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Networking", meta = (ClampMin = "0.0", UIMin = "0", editcondition = "bUseRelaxedMoveCombining"))
+		float RelaxedCombineMaxVRSpeed;
+
+	// Flat allowance (cm) on top of the speed bound to absorb quantization and small delta time differences between the client and server
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Networking", meta = (ClampMin = "0.0", UIMin = "0", editcondition = "bUseRelaxedMoveCombining"))
+		float RelaxedCombineVROffsetTolerance;
+
+	// Max size of the HMD / custom input offsets of a move lasting DeltaTime
+	float GetMaxVROffsetForMove(float DeltaTime) const;
+
+	// Clamps the VR offsets of a move when relaxed combining is on, the client runs it on its new moves and the server on received ones
+	// so that both sides simulate the same offsets. Returns true if anything was clamped.
+	bool ClampVROffsetsForMove(FVector& InOutLFDiff, FVector& InOutCustomInput, float DeltaTime) const;
+
+	// When true the pending and old moves of a move packet are sent as residuals against the new move (timestamps, acceleration, rotations, locations)
+	// The mode is flagged in the packet so the server doesn't need to match
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Networking")
+		bool bDeltaEncodeMoveData;
+
+	// When true position corrections send their location as a residual against the location the client reported for the corrected move
+	// The client resolves the same reference from its saved move, corrections that can't use it are sent in full
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Networking")
+		bool bCompactClientCorrections;
+
+	// Server only, after a correction is sent further ones are held back for this long (seconds) unless the error has grown, 0 sends every correction
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Networking", meta = (ClampMin = "0.0", UIMin = "0"))
+		float MinTimeBetweenClientCorrections;
+
+	// A held back correction is still sent when its error is larger than the last sent ones multiplied by this
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Networking", meta = (ClampMin = "1.0", UIMin = "1"))
+		float ClientCorrectionErrorGrowthFactor;
+
+	// Server side, stores the location the client reported for the move at TimeStamp as the reference of its pending correction (negative TimeStamp clears it)
+	void SetClientCorrectionReference(float TimeStamp, const FVector& ClientReportedLocation)
+	{
+		CorrectionReferenceTimeStamp = TimeStamp;
+		CorrectionReferenceLocation = ClientReportedLocation;
+	}
+
+	// Server side, the reference for a correction at TimeStamp if one was stored
+	bool GetServerCorrectionReference(float TimeStamp, FVector& OutReference) const;
+
+	// Client side, the location that was sent for the saved move at TimeStamp, fails if that move is gone (bOutMoveFound false) or was never sent as a new move
+	bool GetClientCorrectionReference(float TimeStamp, FVector& OutReference, bool& bOutMoveFound) const;
+
+	// Client only, when true corrections that need more than ReplayMergeMoveThreshold saved moves replayed merge contiguous compatible moves into single replay steps
+	// Moves merge under the same rules as move combining, bounded by the max move delta time, their HMD offsets and custom inputs are summed into the step like CombineWith does
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Networking")
+		bool bMergeReplayMoves;
+
+	// Saved move count past which replays start merging moves
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacterMovementComponent|Networking", meta = (ClampMin = "0", UIMin = "0", editcondition = "bMergeReplayMoves"))
+		int32 ReplayMergeMoveThreshold;
+
+	// If NextMove can be replayed in the same step as Move, StepDeltaTime, StepLFDiff and StepCustomInput being the steps sums so far
+	bool CanMergeReplayMoves(const FSavedMovePtr& Move, const FSavedMovePtr& NextMove, float StepDeltaTime, const FVector& StepLFDiff, const FVector& StepCustomInput, float MaxStepDeltaTime) const;
+
+	// Replays the saved move at MoveIndex as one step, merged with the following compatible moves when bMergeReplay is set
+	// Returns the index of the last move that was part of the step
+	int32 ReplaySavedMoveStep(FNetworkPredictionData_Client_Character& ClientData, int32 MoveIndex, bool bMergeReplay, float MaxReplayStepDelta);
+
+	// Applies the summed offsets of a merged replay step on top of its last moves PrepMoveFor
+	virtual void ApplyMergedReplayOffsets(const FVector& StepLFDiff, const FVector& StepCustomInput);
+
+	virtual void ServerMove_HandleMoveData(const FCharacterNetworkMoveDataContainer& MoveDataContainer) override;
+	virtual void ServerMovePacked_ServerReceive(const FCharacterServerMovePackedBits& PackedBits) override;
+
 	// When true the hmd movement injection speed is capped to the maximum movement speed
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement")
 		bool bCapHMDMovementToMaxMovementSpeed;
@@ -336,6 +433,58 @@ public:
 
 	virtual void ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult = NULL) const override;
 
+	// The actual floor traces, ComputeFloorDist wraps this with the per frame floor cache
+	void ComputeFloorDistVR(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult = NULL) const;
+
+	// If true floor queries made in the same frame from (nearly) the same capsule location re-use the last result instead of tracing again
+	// VR movement runs several floor checks per tick from where the capsule already is (root offset, step ups, walking substeps)
+	// Off by default, measure with vrexp.CharacterMovement.BenchStart / BenchReport (FloorQueries vs FloorCacheHits) before turning it on
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement")
+		bool bCacheFloorResults;
+
+	// Max distance that the capsule can have moved since the cached floor query for it to still be re-used
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement", meta = (ClampMin = "0.0", UIMin = "0", editcondition = "bCacheFloorResults"))
+		float FloorCacheLocationTolerance;
+
+	// Clears the cached floor result, call if the world around the character changed mid frame
+	void InvalidateFloorCache() const { FloorCache.FrameCounter = 0; }
+
+private:
+
+	// Last floor query result, only valid for the frame it was taken in
+	struct FVRFloorCache
+	{
+		FFindFloorResult FloorResult;
+		FVector CapsuleLocation = FVector::ZeroVector;
+		FVector GravityDirection = FVector::ZeroVector;
+		float LineDistance = 0.f;
+		float SweepDistance = 0.f;
+		float SweepRadius = 0.f;
+		float HalfHeight = 0.f;
+		TWeakObjectPtr<const UPrimitiveComponent> BaseComponent;
+		FTransform BaseTransform = FTransform::Identity;
+		uint64 FrameCounter = 0;
+	};
+
+	mutable FVRFloorCache FloorCache;
+
+	float CorrectionReferenceTimeStamp = -1.f;
+	FVector CorrectionReferenceLocation = FVector::ZeroVector;
+
+protected:
+
+	// Correction coalescing state
+	float LastClientCorrectionTime = -1000.f;
+	float LastClientCorrectionError = 0.f;
+
+	// Simulated proxy LOD state, updated in SimulatedTick
+	float SimulatedProxyLODAccumulatedTime = 0.f;
+	float SimulatedProxyViewDistanceSq = 0.f;
+	bool bSimulatedProxyIsFar = false;
+	bool bSimulatedProxyLODSkippedFrame = false;
+
+public:
+
 	// Need to use actual capsule location for step up
 	virtual bool VRClimbStepUp(const FVector& GravDir, const FVector& Delta, const FHitResult &InHit, FStepDownResult* OutStepDownResult = nullptr);
 
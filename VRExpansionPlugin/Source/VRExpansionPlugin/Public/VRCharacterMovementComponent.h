@@ -146,6 +146,7 @@ public:
 	virtual void ClientAdjustPositionVR_Implementation(float TimeStamp, FVector NewLoc, /*uint16 NewYaw,*/ FVector NewVel, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode, TOptional<FRotator> OptionalRotation = TOptional<FRotator>(), TOptional<FVector> OptionalGravityDirection = TOptional<FVector>());
 
 	virtual bool ClientUpdatePositionAfterServerUpdate() override;
+	virtual void ApplyMergedReplayOffsets(const FVector& StepLFDiff, const FVector& StepCustomInput) override;
 	///////////////////////////
 	// Replication Functions
 	///////////////////////////
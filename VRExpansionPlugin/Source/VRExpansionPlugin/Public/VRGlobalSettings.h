@@ -67,6 +67,110 @@ public:
 	}
 };
 
+// Settings for scaling server side physics replication error tolerances per object and budgeting corrections per frame
+USTRUCT(BlueprintType, Category = "PhysicsReplication")
+struct VREXPANSIONPLUGIN_API FVRPhysicsReplicationCorrectionProfile
+{
+	GENERATED_BODY()
+public:
+
+	// If true the error tolerances of each replicated body are scaled by its distance to the nearest viewer and its size
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication")
+		bool bUseAdaptiveErrorThresholds;
+
+	// Bodies closer than this to a viewer use the base error tolerances
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseAdaptiveErrorThresholds"))
+		float NearViewerDistance;
+
+	// Bodies at or past this distance from all viewers use FarErrorScale times the base error tolerances
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseAdaptiveErrorThresholds"))
+		float FarViewerDistance;
+
+	// Multiplier on the base error tolerances (MaxRestoredStateError and MaxLinearHardSnapDistance) at FarViewerDistance,
+	// blended linearly from 1 at NearViewerDistance
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "1", UIMin = "1", editcondition = "bUseAdaptiveErrorThresholds"))
+		float FarErrorScale;
+
+	// Bodies with a bounds radius smaller than this get proportionally larger error tolerances
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseAdaptiveErrorThresholds"))
+		float ReferenceRadius;
+
+	// Max error scale that a small body can get from its size
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "1", UIMin = "1", editcondition = "bUseAdaptiveErrorThresholds"))
+		float MaxSizeErrorScale;
+
+	// Max number of bodies to correct in a single frame, the most visible errors are corrected first and the rest wait for the next frame
+	// 0 is unlimited
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "0", UIMin = "0"))
+		int32 MaxCorrectionsPerFrame;
+
+	// Priority multiplier added per second that a body has been waiting on the correction budget, so that small or distant
+	// errors still get corrected eventually instead of starving behind closer bodies
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "0", UIMin = "0", editcondition = "MaxCorrectionsPerFrame > 0"))
+		float WaitTimePriorityScale;
+
+	FVRPhysicsReplicationCorrectionProfile() :
+		bUseAdaptiveErrorThresholds(false),
+		NearViewerDistance(500.0f),
+		FarViewerDistance(5000.0f),
+		FarErrorScale(4.0f),
+		ReferenceRadius(25.0f),
+		MaxSizeErrorScale(2.0f),
+		MaxCorrectionsPerFrame(0),
+		WaitTimePriorityScale(2.0f)
+	{}
+
+	// Returns the scale to apply to the error tolerances of a body
+	float GetErrorScale(float NearestViewerDistance, float BoundsRadius) const;
+};
+
+// Compact serialization settings for FRepMovementVR (client auth movement and throws)
+// Both the server and clients need the same values, the mode itself is flagged in the stream
+USTRUCT(BlueprintType, Category = "PhysicsReplication")
+struct VREXPANSIONPLUGIN_API FVRRepMovementCompactSettings
+{
+	GENERATED_BODY()
+public:
+
+	// If true FRepMovementVR is sent with bounded velocities and a smallest three rotation instead of the engines FRepMovement serialization
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication")
+		bool bUseCompactSerialization;
+
+	// Max linear velocity (cm/s) per axis that is sent bounded, faster values fall back to a packed vector
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "1", UIMin = "1", editcondition = "bUseCompactSerialization"))
+		float MaxLinearVelocity;
+
+	// Bits per axis for bounded linear velocity
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "4", UIMin = "4", ClampMax = "24", UIMax = "24", editcondition = "bUseCompactSerialization"))
+		int32 LinearVelocityBits;
+
+	// Max angular velocity (deg/s) per axis that is sent bounded, faster values fall back to a packed vector
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "1", UIMin = "1", editcondition = "bUseCompactSerialization"))
+		float MaxAngularVelocity;
+
+	// Bits per axis for bounded angular velocity
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "4", UIMin = "4", ClampMax = "24", UIMax = "24", editcondition = "bUseCompactSerialization"))
+		int32 AngularVelocityBits;
+
+	// If true angular velocity is left out (received as zero) for objects that are not spinning
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (editcondition = "bUseCompactSerialization"))
+		bool bOmitSmallAngularVelocity;
+
+	// Angular velocity (deg/s) per axis under which the object is considered not spinning
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PhysicsReplication", meta = (ClampMin = "0", UIMin = "0", editcondition = "bUseCompactSerialization && bOmitSmallAngularVelocity"))
+		float AngularVelocityOmitThreshold;
+
+	FVRRepMovementCompactSettings() :
+		bUseCompactSerialization(false),
+		MaxLinearVelocity(2500.0f),
+		LinearVelocityBits(16),
+		MaxAngularVelocity(1800.0f),
+		AngularVelocityBits(14),
+		bOmitSmallAngularVelocity(true),
+		AngularVelocityOmitThreshold(1.0f)
+	{}
+};
+
 UCLASS(config = Engine, defaultconfig)
 class VREXPANSIONPLUGIN_API UVRGlobalSettings : public UObject
 {
@@ -153,6 +257,20 @@ public:
 	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "ChaosPhysics|Constraints")
 		float JointAngularBreakScale;
 
+	// If true the server will queue incoming controller / HMD pose RPCs and apply only the newest pose per device
+	// once per server tick in a single batched pass (PrePhysics, ahead of the devices and their pawn) instead of applying each one directly in its RPC handler.
+	// Cuts down on redundant transform propagation when clients send faster than the server ticks.
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "Networking")
+		bool bBatchServerTrackedPoseUpdates;
+
+	// Per object error tolerance scaling and correction budget for server side physics replication (client auth throwing)
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "Networking|PhysicsReplication")
+		FVRPhysicsReplicationCorrectionProfile PhysicsReplicationCorrectionProfile;
+
+	// Compact serialization of client auth movement and throw replication
+	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "Networking|PhysicsReplication")
+		FVRRepMovementCompactSettings RepMovementCompactSettings;
+
 	// If we should lerp hybrid with sweep grips out of collision
 	UPROPERTY(config, BlueprintReadWrite, EditAnywhere, Category = "HybridWithSweepLerp")
 		bool bLerpHybridWithSweepGrips;